@@ -234,16 +234,14 @@ namespace combined_robot_hw
         }
 
         std::vector<std::string> r_hw_iface_resources = robot_hw->getInterfaceResources(filtered_iface_resources.hardware_interface);
-        std::set<std::string> filtered_resources;
-        for (std::set<std::string>::const_iterator ctrl_res = res_it->resources.begin(); ctrl_res != res_it->resources.end(); ++ctrl_res)
+        for (std::vector<std::string>::const_iterator hw_res = r_hw_iface_resources.begin(); hw_res != r_hw_iface_resources.end(); ++hw_res)
         {
-          std::vector<std::string>::iterator res_name = std::find(r_hw_iface_resources.begin(), r_hw_iface_resources.end(), *ctrl_res);
-          if (res_name != r_hw_iface_resources.end())
+          std::size_t id;
+          if (hardware_interface::internal::ResourceIds::findId(*hw_res, id) && res_it->hasResource(id))
           {
-            filtered_resources.insert(*ctrl_res);
+            filtered_iface_resources.addResource(*hw_res);
           }
         }
-        filtered_iface_resources.resources = filtered_resources;
         filtered_controller.claimed_resources.push_back(filtered_iface_resources);
       }
       filtered_list.push_back(filtered_controller);
@@ -123,7 +123,8 @@ bool MyRobotHW1::prepareSwitch(const std::list<hardware_interface::ControllerInf
       }
 
       std::vector<std::string> r_hw_iface_resources = this->getInterfaceResources(res_it->hardware_interface);
-      for (std::set<std::string>::const_iterator ctrl_res = res_it->resources.begin(); ctrl_res != res_it->resources.end(); ++ctrl_res)
+      const std::set<std::string> resources = res_it->getResources();
+      for (std::set<std::string>::const_iterator ctrl_res = resources.begin(); ctrl_res != resources.end(); ++ctrl_res)
       {
         std::vector<std::string>::iterator res_name = std::find(r_hw_iface_resources.begin(), r_hw_iface_resources.end(), *ctrl_res);
         if (res_name == r_hw_iface_resources.end()) // this resource is not registered on this RobotHW
@@ -158,7 +159,8 @@ void MyRobotHW1::doSwitch(const std::list<hardware_interface::ControllerInfo>& s
       }
 
       std::vector<std::string> r_hw_iface_resources = this->getInterfaceResources(res_it->hardware_interface);
-      for (std::set<std::string>::const_iterator ctrl_res = res_it->resources.begin(); ctrl_res != res_it->resources.end(); ++ctrl_res)
+      const std::set<std::string> resources = res_it->getResources();
+      for (std::set<std::string>::const_iterator ctrl_res = resources.begin(); ctrl_res != resources.end(); ++ctrl_res)
       {
         std::vector<std::string>::iterator res_name = std::find(r_hw_iface_resources.begin(), r_hw_iface_resources.end(), *ctrl_res);
         if (res_name == r_hw_iface_resources.end()) // this resource is not registered on this RobotHW
@@ -121,7 +121,7 @@ TEST(CombinedRobotHWTests, switchOk)
     controller_1.type = "some_type";
     hardware_interface::InterfaceResources iface_res_1;
     iface_res_1.hardware_interface = "hardware_interface::ForceTorqueSensorInterface";
-    iface_res_1.resources.insert("ft_sensor_1");
+    iface_res_1.addResource("ft_sensor_1");
     controller_1.claimed_resources.push_back(iface_res_1);
     start_list.push_back(controller_1);
     ASSERT_FALSE(robot_hw.prepareSwitch(start_list, stop_list));
@@ -137,23 +137,23 @@ TEST(CombinedRobotHWTests, switchOk)
     controller_1.type = "some_type";
     hardware_interface::InterfaceResources iface_res_1;
     iface_res_1.hardware_interface = "hardware_interface::EffortJointInterface";
-    iface_res_1.resources.insert("test_joint1");
-    iface_res_1.resources.insert("test_joint2");
-    iface_res_1.resources.insert("test_joint3");
-    iface_res_1.resources.insert("test_joint4");
+    iface_res_1.addResource("test_joint1");
+    iface_res_1.addResource("test_joint2");
+    iface_res_1.addResource("test_joint3");
+    iface_res_1.addResource("test_joint4");
     controller_1.claimed_resources.push_back(iface_res_1);
     hardware_interface::InterfaceResources iface_res_2;
     iface_res_2.hardware_interface = "hardware_interface::VelocityJointInterface";
-    iface_res_2.resources.insert("test_joint1");
-    iface_res_2.resources.insert("test_joint4");
+    iface_res_2.addResource("test_joint1");
+    iface_res_2.addResource("test_joint4");
     controller_1.claimed_resources.push_back(iface_res_1);
     start_list.push_back(controller_1);
 
     hardware_interface::ControllerInfo controller_2;
     hardware_interface::InterfaceResources iface_res_3;
     iface_res_3.hardware_interface = "hardware_interface::VelocityJointInterface";
-    iface_res_3.resources.insert("test_joint3");
-    iface_res_3.resources.insert("test_joint5");
+    iface_res_3.addResource("test_joint3");
+    iface_res_3.addResource("test_joint5");
     controller_2.claimed_resources.push_back(iface_res_3);
     start_list.push_back(controller_2);
     ASSERT_TRUE(robot_hw.prepareSwitch(start_list, stop_list));
@@ -170,23 +170,23 @@ TEST(CombinedRobotHWTests, switchOk)
     controller_1.type = "some_type";
     hardware_interface::InterfaceResources iface_res_1;
     iface_res_1.hardware_interface = "hardware_interface::NonRegisteredInterface";
-    iface_res_1.resources.insert("test_joint1");
-    iface_res_1.resources.insert("test_joint2");
-    iface_res_1.resources.insert("test_joint3");
-    iface_res_1.resources.insert("test_joint4");
+    iface_res_1.addResource("test_joint1");
+    iface_res_1.addResource("test_joint2");
+    iface_res_1.addResource("test_joint3");
+    iface_res_1.addResource("test_joint4");
     controller_1.claimed_resources.push_back(iface_res_1);
     hardware_interface::InterfaceResources iface_res_2;
     iface_res_2.hardware_interface = "hardware_interface::VelocityJointInterface";
-    iface_res_2.resources.insert("test_joint1");
-    iface_res_2.resources.insert("non_registered_joint1");
+    iface_res_2.addResource("test_joint1");
+    iface_res_2.addResource("non_registered_joint1");
     controller_1.claimed_resources.push_back(iface_res_1);
     start_list.push_back(controller_1);
 
     hardware_interface::ControllerInfo controller_2;
     hardware_interface::InterfaceResources iface_res_3;
     iface_res_3.hardware_interface = "hardware_interface::VelocityJointInterface";
-    iface_res_3.resources.insert("test_joint3");
-    iface_res_3.resources.insert("non_registered_joint2");
+    iface_res_3.addResource("test_joint3");
+    iface_res_3.addResource("non_registered_joint2");
     controller_2.claimed_resources.push_back(iface_res_3);
     start_list.push_back(controller_2);
     ASSERT_TRUE(robot_hw.prepareSwitch(start_list, stop_list));
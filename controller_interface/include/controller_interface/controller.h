@@ -127,7 +127,7 @@ protected:
       ROS_ERROR("Failed to initialize the controller");
       return false;
     }
-    hardware_interface::InterfaceResources iface_res(getHardwareInterfaceType(), hw->getClaims());
+    hardware_interface::InterfaceResources iface_res(getHardwareInterfaceType(), hw->getClaimIds());
     claimed_resources.assign(1, iface_res);
     hw->clearClaims();
 
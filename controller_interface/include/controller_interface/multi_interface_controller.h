@@ -463,7 +463,7 @@ inline void populateClaimedResources(hardware_interface::RobotHW*      robot_hw,
   {
     hardware_interface::InterfaceResources iface_res;
     iface_res.hardware_interface = hardware_interface::internal::demangledTypeName<T>();
-    iface_res.resources = hw->getClaims();
+    iface_res.resource_ids = hw->getClaimIds();
     claimed_resources.push_back(iface_res);
   }
 }
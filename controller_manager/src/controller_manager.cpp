@@ -641,7 +641,8 @@ bool ControllerManager::listControllersSrv(
     {
       controller_manager_msgs::HardwareInterfaceResources iface_res;
       iface_res.hardware_interface = c_res_it->hardware_interface;
-      std::copy(c_res_it->resources.begin(), c_res_it->resources.end(), std::back_inserter(iface_res.resources));
+      const std::set<std::string> resources = c_res_it->getResources();
+      std::copy(resources.begin(), resources.end(), std::back_inserter(iface_res.resources));
       cs.claimed_resources.push_back(iface_res);
     }
 
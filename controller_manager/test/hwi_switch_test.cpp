@@ -162,7 +162,8 @@ public:
                 return false;
             }
             const hardware_interface::InterfaceResources& iface_res = it->claimed_resources.front();
-            for (std::set<std::string>::const_iterator res_it = iface_res.resources.begin(); res_it != iface_res.resources.end(); ++res_it)
+            const std::set<std::string> resources = iface_res.getResources();
+            for (std::set<std::string>::const_iterator res_it = resources.begin(); res_it != resources.end(); ++res_it)
             {
                 // special check
                 if(iface_res.hardware_interface == "hardware_interface::EffortJointInterface" && *res_it == "j_pe") j_pe_e = true;
@@ -196,7 +197,8 @@ public:
             started_.erase(std::remove(started_.begin(), started_.end(), it->name), started_.end());
             stopped_.push_back(it->name);
             const hardware_interface::InterfaceResources& iface_res = it->claimed_resources.front();
-            for (std::set<std::string>::const_iterator res_it = iface_res.resources.begin(); res_it != iface_res.resources.end(); ++res_it)
+            const std::set<std::string> resources = iface_res.getResources();
+            for (std::set<std::string>::const_iterator res_it = resources.begin(); res_it != resources.end(); ++res_it)
             {
                 switches[*res_it] = "";
             }
@@ -206,7 +208,8 @@ public:
             stopped_.erase(std::remove(stopped_.begin(), stopped_.end(), it->name), stopped_.end());
             started_.push_back(it->name);
             const hardware_interface::InterfaceResources& iface_res = it->claimed_resources.front();
-            for (std::set<std::string>::const_iterator res_it = iface_res.resources.begin(); res_it != iface_res.resources.end(); ++res_it)
+            const std::set<std::string> resources = iface_res.getResources();
+            for (std::set<std::string>::const_iterator res_it = resources.begin(); res_it != resources.end(); ++res_it)
             {
                 switches[*res_it] = iface_res.hardware_interface;
             }
@@ -33,10 +33,14 @@
 #ifndef HARDWARE_INTERFACE_HARDWARE_INTERFACE_H
 #define HARDWARE_INTERFACE_HARDWARE_INTERFACE_H
 
+#include <cstddef>
 #include <exception>
 #include <string>
 #include <set>
 #include <typeinfo>
+#include <vector>
+
+#include <hardware_interface/internal/resource_ids.h>
 
 
 namespace hardware_interface{
@@ -52,19 +56,44 @@ public:
   /** \name Resource management
    *\{**/
 
-  /// Claim a resource by name
-  virtual void claim(std::string resource) { claims_.insert(resource); }
+  /**
+   * \brief Claim a resource by name.
+   *
+   * Claims are recorded as flags indexed by the process-wide id of each resource name (see
+   * \ref internal::ResourceIds). Hence, claiming resources that have already been claimed once, even if claims were
+   * cleared afterwards, does not grow the claim storage.
+   */
+  virtual void claim(std::string resource)
+  {
+    const std::size_t id = internal::ResourceIds::getId(resource);
+    if (id >= claimed_.size()) {claimed_.resize(id + 1, false);}
+    claimed_[id] = true;
+  }
 
   /// Clear the resources this interface is claiming
-  void clearClaims()                       { claims_.clear(); }
+  void clearClaims()                       { claimed_.assign(claimed_.size(), false); }
 
   /// Get the list of resources this interface is currently claiming
-  std::set<std::string> getClaims() const  { return claims_; }
+  std::set<std::string> getClaims() const
+  {
+    std::set<std::string> out;
+    for (std::size_t id = 0; id < claimed_.size(); ++id)
+    {
+      if (claimed_[id]) {out.insert(internal::ResourceIds::getName(id));}
+    }
+    return out;
+  }
+
+  /**
+   * \brief Get the resources this interface is currently claiming, without building their names.
+   * \return Claim flags, indexed by resource id.
+   */
+  const std::vector<bool>& getClaimIds() const {return claimed_;}
 
   /*\}*/
 
 private:
-  std::set<std::string> claims_;
+  std::vector<bool> claimed_; ///< Claim flags, indexed by resource id
 };
 
 
@@ -29,31 +29,80 @@
 #ifndef HARDWARE_INTERFACE_INTERFACE_RESOURCES_H
 #define HARDWARE_INTERFACE_INTERFACE_RESOURCES_H
 
+#include <cstddef>
 #include <set>
 #include <string>
 #include <vector>
 
+#include <hardware_interface/internal/resource_ids.h>
+
 namespace hardware_interface
 {
 
 /**
  * \brief Structure for storing resource identifiers belonging to a specific
  * hardware interface.
+ *
+ * Resources are stored as flags indexed by the process-wide id of each
+ * resource name (see \ref internal::ResourceIds), which is what the conflict
+ * checks compare. The names are also kept in \ref resources for existing
+ * robot hardware code.
  */
 struct InterfaceResources
 {
   InterfaceResources() {}
 
   InterfaceResources(const std::string& hw_iface, const std::set<std::string>& res)
+    : hardware_interface(hw_iface)
+  {
+    for (std::set<std::string>::const_iterator it = res.begin(); it != res.end(); ++it) {addResource(*it);}
+  }
+
+  InterfaceResources(const std::string& hw_iface, const std::vector<bool>& res_ids)
     : hardware_interface(hw_iface),
-      resources(res)
-  {}
+      resource_ids(res_ids)
+  {
+    for (std::size_t id = 0; id < resource_ids.size(); ++id)
+    {
+      if (resource_ids[id]) {resources.insert(internal::ResourceIds::getName(id));}
+    }
+  }
 
   /** Hardware interface type. */
   std::string hardware_interface;
 
-  /** Resources belonging to the hardware interface. */
+  /**
+   * Names of the resources belonging to the hardware interface.
+   * \deprecated Kept for source compatibility. It is filled by the constructors and \ref addResource, but modifying
+   * it directly does not update \ref resource_ids. Use \ref addResource, \ref hasResource and \ref getResources.
+   */
   std::set<std::string> resources;
+
+  /** Resources belonging to the hardware interface, as flags indexed by resource id. */
+  std::vector<bool> resource_ids;
+
+  /** Add a resource by name. */
+  void addResource(const std::string& name)
+  {
+    const std::size_t id = internal::ResourceIds::getId(name);
+    if (id >= resource_ids.size()) {resource_ids.resize(id + 1, false);}
+    resource_ids[id] = true;
+    resources.insert(name);
+  }
+
+  /** \return True if the resource with id \p id belongs to the hardware interface. */
+  bool hasResource(std::size_t id) const {return id < resource_ids.size() && resource_ids[id];}
+
+  /** \return Names of the resources belonging to the hardware interface. */
+  std::set<std::string> getResources() const
+  {
+    std::set<std::string> out;
+    for (std::size_t id = 0; id < resource_ids.size(); ++id)
+    {
+      if (resource_ids[id]) {out.insert(internal::ResourceIds::getName(id));}
+    }
+    return out;
+  }
 };
 
 }
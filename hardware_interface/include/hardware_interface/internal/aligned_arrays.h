@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_ALIGNED_ARRAYS_H
+#define HARDWARE_INTERFACE_ALIGNED_ARRAYS_H
+
+#include <cassert>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace hardware_interface
+{
+
+namespace internal
+{
+
+/// Size in bytes of the cache lines data is aligned to.
+const std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * \brief Fixed set of equally-sized arrays of doubles backed by a single allocation.
+ *
+ * Every array starts on its own cache line, so that data belonging to different arrays (eg. joint positions and joint
+ * commands) never shares a cache line, and loops over a single array can be vectorized.
+ *
+ * Array addresses remain valid for the whole lifetime of the instance.
+ */
+class AlignedArrays
+{
+public:
+  AlignedArrays()
+    : num_arrays_(0), size_(0), stride_(0), offset_(0)
+  {}
+
+  /**
+   * \param num_arrays Number of arrays.
+   * \param size Number of elements of each array.
+   * \param value Initial value of all array elements.
+   */
+  AlignedArrays(std::size_t num_arrays, std::size_t size, double value = 0.0)
+    : num_arrays_(num_arrays),
+      size_(size),
+      stride_(0),
+      offset_(0)
+  {
+    const std::size_t doubles_per_line = CACHE_LINE_SIZE / sizeof(double);
+    stride_ = (size_ + doubles_per_line - 1) / doubles_per_line * doubles_per_line;
+
+    // Over-allocate by one cache line so that the first array can be shifted to an aligned address
+    storage_.assign(num_arrays_ * stride_ + doubles_per_line, value);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(&storage_[0]);
+    const uintptr_t misalignment = address % CACHE_LINE_SIZE;
+    offset_ = misalignment ? (CACHE_LINE_SIZE - misalignment) / sizeof(double) : 0;
+  }
+
+  AlignedArrays(const AlignedArrays& other)
+    : num_arrays_(0), size_(0), stride_(0), offset_(0)
+  {
+    *this = other;
+  }
+
+  AlignedArrays& operator=(const AlignedArrays& other)
+  {
+    if (this == &other) {return *this;}
+
+    // The alignment offset depends on the address of the storage, so it needs to be recomputed
+    AlignedArrays tmp(other.num_arrays_, other.size_);
+    for (std::size_t i = 0; i < other.num_arrays_; ++i)
+    {
+      for (std::size_t j = 0; j < other.size_; ++j) {tmp.data(i)[j] = other.data(i)[j];}
+    }
+    num_arrays_ = tmp.num_arrays_;
+    size_       = tmp.size_;
+    stride_     = tmp.stride_;
+    offset_     = tmp.offset_;
+    storage_.swap(tmp.storage_);
+    return *this;
+  }
+
+  /** \return Number of arrays. */
+  std::size_t numArrays() const {return num_arrays_;}
+
+  /** \return Number of elements of each array. */
+  std::size_t size() const {return size_;}
+
+  /** \return Pointer to the first element of the \e i-th array. */
+  double* data(std::size_t i)
+  {
+    assert(i < num_arrays_);
+    return &storage_[offset_ + i * stride_];
+  }
+
+  /** \return Pointer to the first element of the \e i-th array. */
+  const double* data(std::size_t i) const
+  {
+    assert(i < num_arrays_);
+    return &storage_[offset_ + i * stride_];
+  }
+
+private:
+  std::size_t num_arrays_;
+  std::size_t size_;
+  std::size_t stride_; ///< Distance between the start of two consecutive arrays, multiple of a cache line
+  std::size_t offset_; ///< Position of the first cache-aligned element of the storage
+  std::vector<double> storage_;
+};
+
+} // namespace
+
+} // namespace
+
+#endif // HARDWARE_INTERFACE_ALIGNED_ARRAYS_H
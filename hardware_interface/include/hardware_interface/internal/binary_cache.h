@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_BINARY_CACHE_H
+#define HARDWARE_INTERFACE_BINARY_CACHE_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HARDWARE_INTERFACE_BINARY_CACHE_MMAP
+#endif
+
+namespace hardware_interface
+{
+
+namespace internal
+{
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t FNV_PRIME        = 1099511628211ULL;
+
+/**
+ * \brief 64-bit FNV-1a hash of a block of memory.
+ * \param hash Hash to continue from, so that several blocks can be hashed together.
+ */
+inline uint64_t fnv1aHash(const void* data, std::size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+/** \brief 64-bit FNV-1a hash of a string. */
+inline uint64_t fnv1aHash(const std::string& data, uint64_t hash = FNV_OFFSET_BASIS)
+{
+  return fnv1aHash(data.data(), data.size(), hash);
+}
+
+/**
+ * \brief Header of binary cache files.
+ *
+ * Data is stored in the native byte order and representation of the machine writing it, as cache files are meant to
+ * speed up restarts of processes on the same machine, not to be shared among machines.
+ */
+struct BinaryCacheHeader
+{
+  char     magic[4];     ///< Always "RCBC"
+  uint32_t format;       ///< Identifier and version of the payload layout, defined by the cache user
+  uint64_t key;          ///< Identifier of the data the cache was built from, eg. a hash of a robot description
+  uint64_t payload_size; ///< Size in bytes of the payload following the header
+  uint64_t payload_hash; ///< FNV-1a hash of the payload, to detect truncated or corrupted files
+};
+
+/**
+ * \brief Serializes data into a binary cache file.
+ *
+ * Values are appended to an in-memory payload with the \c write methods, and the payload is stored with \ref save.
+ */
+class BinaryCacheWriter
+{
+public:
+  void write(uint32_t value) {append(&value, sizeof(value));}
+  void write(double value)   {append(&value, sizeof(value));}
+  void write(bool value)     {const unsigned char byte = value ? 1 : 0; append(&byte, 1);}
+
+  void write(const std::string& value)
+  {
+    write(static_cast<uint32_t>(value.size()));
+    append(value.data(), value.size());
+  }
+
+  /**
+   * \brief Store the payload in a cache file.
+   *
+   * The file is first written under a temporary name and then renamed, so concurrent readers never see a partially
+   * written cache.
+   * \param path Cache file path.
+   * \param format Identifier and version of the payload layout.
+   * \param key Identifier of the data the cache is built from.
+   * \return True if successful.
+   */
+  bool save(const std::string& path, uint32_t format, uint64_t key) const
+  {
+    BinaryCacheHeader header;
+    std::memcpy(header.magic, "RCBC", sizeof(header.magic));
+    header.format       = format;
+    header.key          = key;
+    header.payload_size = payload_.size();
+    header.payload_hash = fnv1aHash(payload_);
+
+    std::ostringstream tmp_path;
+    tmp_path << path << ".tmp";
+#ifdef HARDWARE_INTERFACE_BINARY_CACHE_MMAP
+    tmp_path << getpid(); // Processes writing the same cache concurrently do not clobber each other
+#endif
+    {
+      std::ofstream file(tmp_path.str().c_str(), std::ios::binary | std::ios::trunc);
+      if (!file) {return false;}
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(payload_.data(), payload_.size());
+      if (!file.flush()) {std::remove(tmp_path.str().c_str()); return false;}
+    }
+    if (0 != std::rename(tmp_path.str().c_str(), path.c_str()))
+    {
+      std::remove(tmp_path.str().c_str());
+      return false;
+    }
+    return true;
+  }
+
+private:
+  std::string payload_;
+
+  void append(const void* data, std::size_t size) {payload_.append(static_cast<const char*>(data), size);}
+};
+
+/**
+ * \brief Reads data from a binary cache file written by \ref BinaryCacheWriter.
+ *
+ * The file is memory-mapped when the platform supports it, and values are read in the same order they were written.
+ * All \c read methods fail instead of reading past the end of the payload.
+ */
+class BinaryCacheReader
+{
+public:
+  BinaryCacheReader()
+    : data_(0), size_(0), pos_(0), mapping_(0), mapping_size_(0)
+  {}
+
+  ~BinaryCacheReader() {close();}
+
+  /**
+   * \brief Open a cache file.
+   * \param path Cache file path.
+   * \param format Expected identifier and version of the payload layout.
+   * \param key Expected identifier of the data the cache was built from.
+   * \return True if the file exists, is valid, and matches \p format and \p key.
+   */
+  bool open(const std::string& path, uint32_t format, uint64_t key)
+  {
+    close();
+    if (!mapFile(path)) {return false;}
+
+    BinaryCacheHeader header;
+    if (size_ < sizeof(header)) {close(); return false;}
+    std::memcpy(&header, data_, sizeof(header));
+
+    const bool valid = 0 == std::memcmp(header.magic, "RCBC", sizeof(header.magic)) &&
+                       header.format == format &&
+                       header.key == key &&
+                       header.payload_size == size_ - sizeof(header) &&
+                       header.payload_hash == fnv1aHash(data_ + sizeof(header), header.payload_size);
+    if (!valid) {close(); return false;}
+
+    pos_ = sizeof(header);
+    return true;
+  }
+
+  /** \brief Release the cache file. */
+  void close()
+  {
+#ifdef HARDWARE_INTERFACE_BINARY_CACHE_MMAP
+    if (mapping_) {munmap(mapping_, mapping_size_);}
+#endif
+    mapping_      = 0;
+    mapping_size_ = 0;
+    buffer_.clear();
+    data_ = 0;
+    size_ = 0;
+    pos_  = 0;
+  }
+
+  /** \return True if all the payload has been read. */
+  bool atEnd() const {return data_ && pos_ == size_;}
+
+  bool read(uint32_t& value) {return extract(&value, sizeof(value));}
+  bool read(double& value)   {return extract(&value, sizeof(value));}
+
+  bool read(bool& value)
+  {
+    unsigned char byte = 0;
+    if (!extract(&byte, 1)) {return false;}
+    value = (byte != 0);
+    return true;
+  }
+
+  bool read(std::string& value)
+  {
+    uint32_t size = 0;
+    if (!read(size) || size > size_ - pos_) {return false;}
+    value.assign(data_ + pos_, size);
+    pos_ += size;
+    return true;
+  }
+
+private:
+  const char*       data_;
+  std::size_t       size_;
+  std::size_t       pos_;
+  void*             mapping_;
+  std::size_t       mapping_size_;
+  std::vector<char> buffer_; ///< File contents, if memory mapping is not available
+
+  bool extract(void* value, std::size_t size)
+  {
+    if (!data_ || size > size_ - pos_) {return false;}
+    std::memcpy(value, data_ + pos_, size); // Values are not aligned in the payload
+    pos_ += size;
+    return true;
+  }
+
+  bool mapFile(const std::string& path)
+  {
+#ifdef HARDWARE_INTERFACE_BINARY_CACHE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {return false;}
+
+    struct stat file_stat;
+    if (0 != fstat(fd, &file_stat) || file_stat.st_size <= 0) {::close(fd); return false;}
+
+    void* mapping = mmap(0, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping remains valid after closing the file
+    if (mapping == MAP_FAILED) {return false;}
+
+    mapping_      = mapping;
+    mapping_size_ = file_stat.st_size;
+    data_         = static_cast<const char*>(mapping);
+    size_         = mapping_size_;
+    return true;
+#else
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) {return false;}
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (buffer_.empty()) {return false;}
+    data_ = &buffer_[0];
+    size_ = buffer_.size();
+    return true;
+#endif
+  }
+
+  BinaryCacheReader(const BinaryCacheReader&);
+  BinaryCacheReader& operator=(const BinaryCacheReader&);
+};
+
+} // namespace
+
+} // namespace
+
+#endif // HARDWARE_INTERFACE_BINARY_CACHE_H
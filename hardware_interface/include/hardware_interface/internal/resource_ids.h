@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_RESOURCE_IDS_H
+#define HARDWARE_INTERFACE_RESOURCE_IDS_H
+
+#include <cstddef>
+#include <string>
+
+namespace hardware_interface
+{
+
+namespace internal
+{
+
+/**
+ * \brief Process-wide table assigning a dense id to every resource name claimed by a hardware interface.
+ *
+ * Ids are shared by all hardware interfaces, so claims on the same resource through different interfaces map to the
+ * same id. Ids are never released, and names are stored once per process. Lookups are serialized, as claims happen
+ * during controller initialization, which is not realtime-critical.
+ *
+ * The table lives in the hardware_interface library, not in this header, so that the controller manager, robot
+ * hardware plugins and controller plugins all share a single table, whatever the symbol visibility they are built with.
+ */
+class ResourceIds
+{
+public:
+  /// \return Id of \p name, which is assigned if this is the first time the name is seen.
+  static std::size_t getId(const std::string& name);
+
+  /**
+   * \brief Find the id of a resource name without assigning one.
+   * \param[in] name Resource name.
+   * \param[out] id Id of \p name, if found.
+   * \return True if \p name has already been assigned an id.
+   */
+  static bool findId(const std::string& name, std::size_t& id);
+
+  /// \return Name of the resource with id \p id, which must have been returned by \ref getId.
+  static const std::string& getName(std::size_t id);
+};
+
+} // namespace
+
+} // namespace
+
+#endif // HARDWARE_INTERFACE_RESOURCE_IDS_H
@@ -87,6 +87,16 @@ public:
     return out;
   }
 
+  /**
+   * \param name Resource name.
+   * \return True if a resource named \e name is registered to this interface.
+   * \note Unlike querying \ref getNames, this method does not copy the names of the registered resources.
+   */
+  bool hasHandle(const std::string& name) const
+  {
+    return resource_map_.find(name) != resource_map_.end();
+  }
+
   /**
    * \brief Register a new resource.
    * If the resource name already exists, the previously stored resource value will be replaced with \e val.
@@ -97,13 +107,14 @@ public:
     typename ResourceMap::iterator it = resource_map_.find(handle.getName());
     if (it == resource_map_.end())
     {
-      resource_map_.insert(std::make_pair(handle.getName(), handle));
+      onResourceAdded(resource_map_.insert(std::make_pair(handle.getName(), handle)).first);
     }
     else
     {
       ROS_WARN_STREAM("Replacing previously registered handle '" << handle.getName() << "' in '" +
                       internal::demangledTypeName(*this) + "'.");
       it->second = handle;
+      onResourceReplaced();
     }
   }
 
@@ -156,6 +167,24 @@ public:
 protected:
   typedef std::map<std::string, ResourceHandle> ResourceMap;
   ResourceMap resource_map_;
+
+  /**
+   * \brief Called after a new resource has been added to \ref resource_map_.
+   *
+   * Derived classes can override this method to update data derived from the set of registered resources.
+   * Replacing an existing resource does not trigger this call, as it leaves the map structure unchanged.
+   * The hooks are virtual so that they are also invoked when handles are registered through a pointer to this class,
+   * as done by \ref concatManagers. They don't add a vtable, as \ref ResourceManagerBase already has one.
+   * \param it Position of the new resource in \ref resource_map_.
+   */
+  virtual void onResourceAdded(typename ResourceMap::iterator /*it*/) {}
+
+  /**
+   * \brief Called after an existing resource of \ref resource_map_ has been replaced.
+   *
+   * Derived classes can override this method to update data derived from the contents of the registered resources.
+   */
+  virtual void onResourceReplaced() {}
 };
 
 }
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_JOINT_DATA_BUFFER_H
+#define HARDWARE_INTERFACE_JOINT_DATA_BUFFER_H
+
+#include <cassert>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/internal/aligned_arrays.h>
+#include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/joint_state_interface.h>
+
+namespace hardware_interface
+{
+
+/**
+ * \brief Contiguous storage for the state and command of a set of joints.
+ *
+ * Joint positions, velocities, efforts and commands are each stored in a separate contiguous array (structure of
+ * arrays layout), with every array starting on its own cache line. The \e i-th element of each array belongs to the
+ * \e i-th joint passed on construction.
+ *
+ * A \ref RobotHW implementation can use an instance of this class as its raw data storage, and register all joints in
+ * one call, as in the following example:
+ * \code
+ * class FooRobot : public hardware_interface::RobotHW
+ * {
+ * public:
+ *   FooRobot(const std::vector<std::string>& joint_names)
+ *     : joint_data_(joint_names)
+ *   {
+ *     joint_data_.registerHandles(jnt_state_interface_);
+ *     joint_data_.registerHandles(jnt_pos_interface_);
+ *     registerInterface(&jnt_state_interface_);
+ *     registerInterface(&jnt_pos_interface_);
+ *   }
+ *
+ *   void read(const ros::Time& time, const ros::Duration& period)
+ *   {
+ *     double* pos = joint_data_.getPositions();
+ *     for (std::size_t i = 0; i < joint_data_.size(); ++i) {pos[i] = ...;}
+ *   }
+ *
+ * private:
+ *   hardware_interface::JointDataBuffer        joint_data_;
+ *   hardware_interface::JointStateInterface    jnt_state_interface_;
+ *   hardware_interface::PositionJointInterface jnt_pos_interface_;
+ * };
+ * \endcode
+ *
+ * \note Handles created from this buffer point to its internal storage, so the buffer must outlive them.
+ */
+class JointDataBuffer
+{
+public:
+  /**
+   * \param joint_names Names of the joints whose data is stored in the buffer. The order of the names defines the
+   * position of each joint in the data arrays.
+   * \pre Joint names must be unique.
+   */
+  explicit JointDataBuffer(const std::vector<std::string>& joint_names)
+    : names_(joint_names),
+      data_(NUM_FIELDS, joint_names.size(), std::numeric_limits<double>::quiet_NaN())
+  {
+    for (std::size_t i = 0; i < names_.size(); ++i)
+    {
+      if (!index_.insert(std::make_pair(names_[i], i)).second)
+      {
+        throw HardwareInterfaceException("Cannot create joint data buffer. Joint '" + names_[i] +
+                                         "' is specified more than once.");
+      }
+    }
+  }
+
+  /** \return Number of joints stored in the buffer. */
+  std::size_t size() const {return names_.size();}
+
+  /** \return Names of the joints stored in the buffer, sorted by their position in the data arrays. */
+  const std::vector<std::string>& getNames() const {return names_;}
+
+  /**
+   * \param name Joint name.
+   * \return Position of the joint in the data arrays. If the joint is not found, an exception is thrown.
+   */
+  std::size_t getIndex(const std::string& name) const
+  {
+    std::map<std::string, std::size_t>::const_iterator it = index_.find(name);
+    if (it == index_.end())
+    {
+      throw HardwareInterfaceException("Could not find joint '" + name + "' in joint data buffer.");
+    }
+    return it->second;
+  }
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+  double* getPositions()  {return data_.data(POSITION);}
+  double* getVelocities() {return data_.data(VELOCITY);}
+  double* getEfforts()    {return data_.data(EFFORT);}
+  double* getCommands()   {return data_.data(COMMAND);}
+
+  const double* getPositions()  const {return data_.data(POSITION);}
+  const double* getVelocities() const {return data_.data(VELOCITY);}
+  const double* getEfforts()    const {return data_.data(EFFORT);}
+  const double* getCommands()   const {return data_.data(COMMAND);}
+  /*\}*/
+
+  /** \return Handle for reading the state of the \e i-th joint of the buffer. */
+  JointStateHandle getStateHandle(std::size_t i) const
+  {
+    assert(i < size());
+    return JointStateHandle(names_[i], getPositions() + i, getVelocities() + i, getEfforts() + i);
+  }
+
+  /** \return Handle for reading the state and writing the command of the \e i-th joint of the buffer. */
+  JointHandle getCommandHandle(std::size_t i)
+  {
+    return JointHandle(getStateHandle(i), getCommands() + i);
+  }
+
+  /** \brief Register a state handle for every joint of the buffer. */
+  void registerHandles(JointStateInterface& iface) const
+  {
+    for (std::size_t i = 0; i < size(); ++i) {iface.registerHandle(getStateHandle(i));}
+  }
+
+  /** \brief Register a command handle for every joint of the buffer. */
+  void registerHandles(JointCommandInterface& iface)
+  {
+    for (std::size_t i = 0; i < size(); ++i) {iface.registerHandle(getCommandHandle(i));}
+  }
+
+private:
+  enum Field
+  {
+    POSITION = 0,
+    VELOCITY,
+    EFFORT,
+    COMMAND,
+    NUM_FIELDS
+  };
+
+  std::vector<std::string> names_;
+  std::map<std::string, std::size_t> index_;
+  internal::AlignedArrays data_;
+
+  JointDataBuffer(const JointDataBuffer&);
+  JointDataBuffer& operator=(const JointDataBuffer&);
+};
+
+}
+
+#endif // HARDWARE_INTERFACE_JOINT_DATA_BUFFER_H
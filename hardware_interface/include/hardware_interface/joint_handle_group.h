@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_JOINT_HANDLE_GROUP_H
+#define HARDWARE_INTERFACE_JOINT_HANDLE_GROUP_H
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/joint_command_interface.h>
+
+namespace hardware_interface
+{
+
+/**
+ * \brief Group of joint handles that can be read and commanded as a whole.
+ *
+ * A group is built by getting from a \ref JointCommandInterface the handles of a list of joints (so the joints are
+ * claimed exactly as when getting the handles one by one). Once built, the state of all joints can be gathered into
+ * an array and all commands scattered from an array with a single call.
+ *
+ * When the data of the grouped joints is contiguous in memory and in group order (eg. it is stored in a
+ * \ref JointDataBuffer), gathering and scattering become plain array copies. Otherwise, they fall back to iterating a
+ * precomputed array of data pointers, without going through the handles.
+ *
+ * Arrays are raw pointers to \ref size() elements, so any storage exposing its data can be used, as in the following
+ * example using Eigen:
+ * \code
+ * hardware_interface::JointHandleGroup group(pos_iface, joint_names);
+ * Eigen::VectorXd q(group.size()), q_cmd(group.size());
+ *
+ * group.getPositions(q.data());
+ * q_cmd = ...;
+ * group.setCommands(q_cmd.data());
+ * \endcode
+ */
+class JointHandleGroup
+{
+public:
+  JointHandleGroup() {}
+
+  /**
+   * \param iface Interface to get the joint handles from.
+   * \param names Names of the joints of the group. Their order defines the position of each joint in the arrays.
+   * If a joint is not found in \e iface, an exception is thrown.
+   */
+  JointHandleGroup(JointCommandInterface& iface, const std::vector<std::string>& names)
+  {
+    handles_.reserve(names.size());
+    for (std::vector<std::string>::const_iterator it = names.begin(); it != names.end(); ++it)
+    {
+      handles_.push_back(iface.getHandle(*it));
+    }
+
+    pos_.init(handles_, &JointHandle::getPositionPtr);
+    vel_.init(handles_, &JointHandle::getVelocityPtr);
+    eff_.init(handles_, &JointHandle::getEffortPtr);
+
+    cmd_.ptrs.reserve(handles_.size());
+    for (std::vector<JointHandle>::iterator it = handles_.begin(); it != handles_.end(); ++it)
+    {
+      cmd_.ptrs.push_back(it->getCommandPtr());
+    }
+    cmd_.initContiguous();
+  }
+
+  /** \return Number of joints of the group. */
+  std::size_t size() const {return handles_.size();}
+
+  /** \return Handle of the \e i-th joint of the group. */
+  const JointHandle& getHandle(std::size_t i) const {assert(i < size()); return handles_[i];}
+
+  /** \return Handles of the joints of the group. */
+  const std::vector<JointHandle>& getHandles() const {return handles_;}
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /** \brief Copy joint positions to \e out, which must have room for \ref size() elements. */
+  void getPositions(double* out) const {pos_.gather(out);}
+
+  /** \brief Copy joint velocities to \e out, which must have room for \ref size() elements. */
+  void getVelocities(double* out) const {vel_.gather(out);}
+
+  /** \brief Copy joint efforts to \e out, which must have room for \ref size() elements. */
+  void getEfforts(double* out) const {eff_.gather(out);}
+
+  /** \brief Copy the current joint commands to \e out, which must have room for \ref size() elements. */
+  void getCommands(double* out) const {cmd_.gather(out);}
+
+  /** \brief Set the commands of all joints from \e in, which must contain \ref size() elements. */
+  void setCommands(const double* in) {cmd_.scatter(in);}
+
+  /**
+   * \return Pointer to the contiguous joint positions, or null if positions are not stored contiguously in group
+   * order. In the former case, joint positions can be read directly without copying them.
+   */
+  const double* getPositionsPtr() const {return pos_.base;}
+
+  /** \return Pointer to the contiguous joint velocities, or null if not contiguous. \sa getPositionsPtr */
+  const double* getVelocitiesPtr() const {return vel_.base;}
+
+  /** \return Pointer to the contiguous joint efforts, or null if not contiguous. \sa getPositionsPtr */
+  const double* getEffortsPtr() const {return eff_.base;}
+
+  /** \return Pointer to the contiguous joint commands, or null if not contiguous. \sa getPositionsPtr */
+  double* getCommandsPtr() {return cmd_.base;}
+  /*\}*/
+
+private:
+  /** \cond HIDDEN_SYMBOLS */
+  template <class T>
+  struct DataPtrs
+  {
+    DataPtrs() : base(0) {}
+
+    void init(const std::vector<JointHandle>& handles, const double* (JointStateHandle::*getter)() const)
+    {
+      ptrs.reserve(handles.size());
+      for (std::vector<JointHandle>::const_iterator it = handles.begin(); it != handles.end(); ++it)
+      {
+        ptrs.push_back(((*it).*getter)());
+      }
+      initContiguous();
+    }
+
+    void initContiguous()
+    {
+      base = 0;
+      for (std::size_t i = 0; i < ptrs.size(); ++i)
+      {
+        if (ptrs[i] != ptrs[0] + i) {return;}
+      }
+      if (!ptrs.empty()) {base = ptrs[0];}
+    }
+
+    void gather(double* out) const
+    {
+      if (base) {std::copy(base, base + ptrs.size(), out);}
+      else
+      {
+        for (std::size_t i = 0; i < ptrs.size(); ++i) {out[i] = *ptrs[i];}
+      }
+    }
+
+    void scatter(const double* in) const
+    {
+      if (base) {std::copy(in, in + ptrs.size(), base);}
+      else
+      {
+        for (std::size_t i = 0; i < ptrs.size(); ++i) {*ptrs[i] = in[i];}
+      }
+    }
+
+    std::vector<T*> ptrs;
+    T* base; ///< First element of the data, if it is contiguous. Null otherwise.
+  };
+  /** \endcond */
+
+  std::vector<JointHandle> handles_;
+  DataPtrs<const double> pos_;
+  DataPtrs<const double> vel_;
+  DataPtrs<const double> eff_;
+  DataPtrs<double>       cmd_;
+};
+
+}
+
+#endif // HARDWARE_INTERFACE_JOINT_HANDLE_GROUP_H
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HARDWARE_INTERFACE_JOINT_HANDLE_VIEW_H
+#define HARDWARE_INTERFACE_JOINT_HANDLE_VIEW_H
+
+#include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/joint_state_interface.h>
+
+namespace hardware_interface
+{
+
+/** \brief Joint data fields that can be accessed through a \ref JointHandleView. */
+namespace joint_fields
+{
+enum
+{
+  POSITION = 1 << 0,
+  VELOCITY = 1 << 1,
+  EFFORT   = 1 << 2,
+  COMMAND  = 1 << 3
+};
+}
+
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+// One base class per field. Disabled fields are empty, and take no space in the derived view thanks to the empty base
+// optimization.
+template <bool Enabled> struct JointPositionField
+{
+  JointPositionField() {}
+  JointPositionField(const JointStateHandle&) {}
+};
+
+template <> struct JointPositionField<true>
+{
+  JointPositionField() : pos_(0) {}
+  JointPositionField(const JointStateHandle& h) : pos_(h.getPositionPtr()) {}
+  double getPosition() const {return *pos_;}
+  const double* getPositionPtr() const {return pos_;}
+private:
+  const double* pos_;
+};
+
+template <bool Enabled> struct JointVelocityField
+{
+  JointVelocityField() {}
+  JointVelocityField(const JointStateHandle&) {}
+};
+
+template <> struct JointVelocityField<true>
+{
+  JointVelocityField() : vel_(0) {}
+  JointVelocityField(const JointStateHandle& h) : vel_(h.getVelocityPtr()) {}
+  double getVelocity() const {return *vel_;}
+  const double* getVelocityPtr() const {return vel_;}
+private:
+  const double* vel_;
+};
+
+template <bool Enabled> struct JointEffortField
+{
+  JointEffortField() {}
+  JointEffortField(const JointStateHandle&) {}
+};
+
+template <> struct JointEffortField<true>
+{
+  JointEffortField() : eff_(0) {}
+  JointEffortField(const JointStateHandle& h) : eff_(h.getEffortPtr()) {}
+  double getEffort() const {return *eff_;}
+  const double* getEffortPtr() const {return eff_;}
+private:
+  const double* eff_;
+};
+
+template <bool Enabled> struct JointCommandField
+{
+  JointCommandField() {}
+  JointCommandField(JointHandle) {}
+};
+
+template <> struct JointCommandField<true>
+{
+  JointCommandField() : cmd_(0) {}
+  JointCommandField(JointHandle h) : cmd_(h.getCommandPtr()) {}
+  void setCommand(double command) const {*cmd_ = command;}
+  double getCommand() const {return *cmd_;}
+  double* getCommandPtr() const {return cmd_;}
+private:
+  double* cmd_;
+};
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief Lightweight handle giving access to a subset of the data of a joint.
+ *
+ * A view stores only the data pointers of the fields selected through the \b Fields template parameter, and does not
+ * store the joint name, so a view accessing a single field has the size of a pointer. This allows controllers
+ * operating on many joints to keep their handles packed in few cache lines. Data is accessed without further checks,
+ * as pointer validity is already enforced when creating the handle a view is built from.
+ *
+ * Views are created from regular handles, so resources are claimed as usual:
+ * \code
+ * hardware_interface::JointPositionCommandView view(pos_iface.getHandle("joint_1"));
+ * view.setCommand(view.getPosition() + 0.1);
+ * \endcode
+ *
+ * \tparam Fields Bitwise combination of \ref joint_fields values specifying the accessible fields.
+ * \note As with regular handles, the underlying data storage must outlive its views.
+ */
+template <unsigned Fields>
+class JointHandleView : public internal::JointPositionField<(Fields & joint_fields::POSITION) != 0>,
+                        public internal::JointVelocityField<(Fields & joint_fields::VELOCITY) != 0>,
+                        public internal::JointEffortField<(Fields & joint_fields::EFFORT) != 0>,
+                        public internal::JointCommandField<(Fields & joint_fields::COMMAND) != 0>
+{
+  typedef internal::JointPositionField<(Fields & joint_fields::POSITION) != 0> PositionField;
+  typedef internal::JointVelocityField<(Fields & joint_fields::VELOCITY) != 0> VelocityField;
+  typedef internal::JointEffortField<(Fields & joint_fields::EFFORT) != 0>     EffortField;
+  typedef internal::JointCommandField<(Fields & joint_fields::COMMAND) != 0>   CommandField;
+
+public:
+  JointHandleView() {}
+
+  /** \param h Handle to read and command the joint. */
+  JointHandleView(JointHandle h)
+    : PositionField(h), VelocityField(h), EffortField(h), CommandField(h)
+  {}
+
+  /** \param h Handle to read the joint state. Only valid for views that do not give access to the joint command. */
+  JointHandleView(const JointStateHandle& h)
+    : PositionField(h), VelocityField(h), EffortField(h), CommandField()
+  {
+    static_assert(!(Fields & joint_fields::COMMAND), "Cannot create a command view from a joint state handle.");
+  }
+};
+
+/// View for reading the position of a joint.
+typedef JointHandleView<joint_fields::POSITION> JointPositionView;
+
+/// View for reading the position, velocity and effort of a joint.
+typedef JointHandleView<joint_fields::POSITION | joint_fields::VELOCITY | joint_fields::EFFORT> JointStateView;
+
+/// View for writing the command of a joint.
+typedef JointHandleView<joint_fields::COMMAND> JointCommandView;
+
+/// View for reading the position and writing the command of a joint.
+typedef JointHandleView<joint_fields::POSITION | joint_fields::COMMAND> JointPositionCommandView;
+
+}
+
+#endif // HARDWARE_INTERFACE_JOINT_HANDLE_VIEW_H
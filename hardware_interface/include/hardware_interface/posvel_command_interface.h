@@ -74,6 +74,11 @@ public:
   double getCommandPosition()     const {assert(cmd_pos_); return *cmd_pos_;}
   double getCommandVelocity()     const {assert(cmd_vel_); return *cmd_vel_;}
 
+  const double* getCommandPositionPtr() const {assert(cmd_pos_); return cmd_pos_;}
+  const double* getCommandVelocityPtr() const {assert(cmd_vel_); return cmd_vel_;}
+  double* getCommandPositionPtr() {assert(cmd_pos_); return cmd_pos_;}
+  double* getCommandVelocityPtr() {assert(cmd_vel_); return cmd_vel_;}
+
 private:
   double* cmd_pos_;
   double* cmd_vel_;
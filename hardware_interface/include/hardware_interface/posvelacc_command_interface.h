@@ -69,6 +69,9 @@ public:
   void setCommandAcceleration(double cmd_acc) {assert(cmd_acc_); *cmd_acc_ = cmd_acc;}
   double getCommandAcceleration() const {assert(cmd_acc_); return *cmd_acc_;}
 
+  const double* getCommandAccelerationPtr() const {assert(cmd_acc_); return cmd_acc_;}
+  double* getCommandAccelerationPtr() {assert(cmd_acc_); return cmd_acc_;}
+
 private:
   double* cmd_acc_;
 };
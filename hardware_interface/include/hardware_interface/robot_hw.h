@@ -90,12 +90,11 @@ public:
    */
   virtual bool checkForConflict(const std::list<ControllerInfo>& info) const
   {
-    // Map from resource name to all controllers claiming it
-    typedef std::map<std::string, std::list<ControllerInfo> > CtrlInfoMap;
+    // Map from resource id to all controllers claiming it
+    typedef std::map<std::size_t, std::list<ControllerInfo> > CtrlInfoMap;
 
     typedef std::list<ControllerInfo>::const_iterator CtrlInfoIt;
     typedef std::vector<InterfaceResources>::const_iterator ClaimedResIt;
-    typedef std::set<std::string>::const_iterator ResourceIt;
 
     // Populate a map of all controllers claiming individual resources.
     // We do this by iterating over every claimed resource of every hardware interface used by every controller
@@ -105,10 +104,10 @@ public:
       const std::vector<InterfaceResources>& c_res = info_it->claimed_resources;
       for (ClaimedResIt c_res_it = c_res.begin(); c_res_it != c_res.end(); ++c_res_it)
       {
-        const std::set<std::string>& iface_resources = c_res_it->resources;
-        for (ResourceIt resource_it = iface_resources.begin(); resource_it != iface_resources.end(); ++resource_it)
+        const std::vector<bool>& iface_resources = c_res_it->resource_ids;
+        for (std::size_t id = 0; id < iface_resources.size(); ++id)
         {
-          resource_map[*resource_it].push_back(*info_it);
+          if (iface_resources[id]) {resource_map[id].push_back(*info_it);}
         }
       }
     }
@@ -122,7 +121,8 @@ public:
         std::string controller_list;
         for (CtrlInfoIt controller_it = it->second.begin(); controller_it != it->second.end(); ++controller_it)
           controller_list += controller_it->name + ", ";
-        ROS_WARN("Resource conflict on [%s].  Controllers = [%s]", it->first.c_str(), controller_list.c_str());
+        ROS_WARN("Resource conflict on [%s].  Controllers = [%s]", internal::ResourceIds::getName(it->first).c_str(),
+                 controller_list.c_str());
         in_conflict = true;
       }
     }
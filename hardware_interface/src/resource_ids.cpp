@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <deque>
+#include <map>
+
+#include <boost/thread/mutex.hpp>
+
+#include <hardware_interface/internal/resource_ids.h>
+
+namespace hardware_interface
+{
+
+namespace internal
+{
+
+namespace
+{
+
+struct ResourceIdTable
+{
+  boost::mutex mutex;
+  std::map<std::string, std::size_t> ids;
+  std::deque<std::string> names; // Elements of a deque are not relocated on push_back
+};
+
+ResourceIdTable& resourceIdTable()
+{
+  static ResourceIdTable table;
+  return table;
+}
+
+} // namespace
+
+std::size_t ResourceIds::getId(const std::string& name)
+{
+  ResourceIdTable& table = resourceIdTable();
+  boost::mutex::scoped_lock lock(table.mutex);
+  std::map<std::string, std::size_t>::const_iterator it = table.ids.find(name);
+  if (it != table.ids.end()) {return it->second;}
+
+  const std::size_t id = table.names.size();
+  table.names.push_back(name);
+  table.ids.insert(std::make_pair(name, id));
+  return id;
+}
+
+bool ResourceIds::findId(const std::string& name, std::size_t& id)
+{
+  ResourceIdTable& table = resourceIdTable();
+  boost::mutex::scoped_lock lock(table.mutex);
+  std::map<std::string, std::size_t>::const_iterator it = table.ids.find(name);
+  if (it == table.ids.end()) {return false;}
+  id = it->second;
+  return true;
+}
+
+const std::string& ResourceIds::getName(std::size_t id)
+{
+  ResourceIdTable& table = resourceIdTable();
+  boost::mutex::scoped_lock lock(table.mutex);
+  return table.names[id];
+}
+
+} // namespace
+
+} // namespace
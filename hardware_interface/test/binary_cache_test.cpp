@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <hardware_interface/internal/binary_cache.h>
+
+using namespace hardware_interface::internal;
+
+class BinaryCacheTest : public ::testing::Test
+{
+public:
+  BinaryCacheTest()
+    : path("/tmp/hardware_interface_binary_cache_test.bin")
+  {
+    writer.write(uint32_t(42));
+    writer.write(-1.5);
+    writer.write(true);
+    writer.write(std::string("foo_joint"));
+    writer.write(std::string());
+  }
+
+  ~BinaryCacheTest() {std::remove(path.c_str());}
+
+protected:
+  std::string path;
+  BinaryCacheWriter writer;
+};
+
+TEST(FnvHashTest, Hash)
+{
+  // Reference values of the 64-bit FNV-1a hash
+  EXPECT_EQ(14695981039346656037ULL, fnv1aHash(std::string()));
+  EXPECT_EQ(12638187200555641996ULL, fnv1aHash(std::string("a")));
+  EXPECT_EQ(fnv1aHash(std::string("foobar")), fnv1aHash(std::string("bar"), fnv1aHash(std::string("foo"))));
+}
+
+TEST_F(BinaryCacheTest, RoundTrip)
+{
+  ASSERT_TRUE(writer.save(path, 1, 1234));
+
+  BinaryCacheReader reader;
+  ASSERT_TRUE(reader.open(path, 1, 1234));
+
+  uint32_t u = 0;
+  double d = 0.0;
+  bool b = false;
+  std::string s1, s2 = "not_empty";
+  EXPECT_TRUE(reader.read(u));
+  EXPECT_TRUE(reader.read(d));
+  EXPECT_TRUE(reader.read(b));
+  EXPECT_TRUE(reader.read(s1));
+  EXPECT_TRUE(reader.read(s2));
+  EXPECT_EQ(42u, u);
+  EXPECT_EQ(-1.5, d);
+  EXPECT_TRUE(b);
+  EXPECT_EQ("foo_joint", s1);
+  EXPECT_TRUE(s2.empty());
+  EXPECT_TRUE(reader.atEnd());
+
+  // Reading past the end fails
+  EXPECT_FALSE(reader.read(d));
+}
+
+TEST_F(BinaryCacheTest, Mismatch)
+{
+  ASSERT_TRUE(writer.save(path, 1, 1234));
+
+  BinaryCacheReader reader;
+  EXPECT_FALSE(reader.open(path + ".missing", 1, 1234));
+  EXPECT_FALSE(reader.open(path, 2, 1234)); // Different format
+  EXPECT_FALSE(reader.open(path, 1, 4321)); // Different key
+  EXPECT_TRUE(reader.open(path, 1, 1234));
+}
+
+TEST_F(BinaryCacheTest, Corruption)
+{
+  ASSERT_TRUE(writer.save(path, 1, 1234));
+
+  // Flip the last byte of the payload
+  {
+    std::fstream file(path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(-1, std::ios::end);
+    const char c = file.get();
+    file.seekp(-1, std::ios::end);
+    file.put(c ^ 0x1);
+  }
+
+  BinaryCacheReader reader;
+  EXPECT_FALSE(reader.open(path, 1, 1234));
+  uint32_t u = 0;
+  EXPECT_FALSE(reader.read(u));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
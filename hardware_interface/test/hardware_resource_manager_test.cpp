@@ -34,6 +34,7 @@
 
 #include <gtest/gtest.h>
 
+#include <hardware_interface/interface_resources.h>
 #include <hardware_interface/internal/hardware_resource_manager.h>
 
 using std::find;
@@ -79,6 +80,11 @@ TEST_F(HardwareResourceManagerTest, ExcerciseApi)
   EXPECT_TRUE(find(names.begin(), names.end(), h1.getName()) != names.end());
   EXPECT_TRUE(find(names.begin(), names.end(), h2.getName()) != names.end());
 
+  // Membership queries
+  EXPECT_TRUE(mgr.hasHandle(h1.getName()));
+  EXPECT_TRUE(mgr.hasHandle(h2.getName()));
+  EXPECT_FALSE(mgr.hasHandle("no_resource"));
+
   // Get handles
   EXPECT_NO_THROW(mgr.getHandle(h1.getName()));
   EXPECT_NO_THROW(mgr.getHandle(h2.getName()));
@@ -178,6 +184,65 @@ TEST_F(HardwareResourceManagerTest, ResourceClaims)
   }
 }
 
+TEST_F(HardwareResourceManagerTest, ClearClaims)
+{
+  HardwareResourceManager<HandleType, ClaimResources> mgr;
+  mgr.registerHandle(h1);
+  mgr.registerHandle(h2);
+
+  mgr.getHandle(h1.getName());
+  mgr.getHandle(h2.getName());
+  EXPECT_EQ(2, mgr.getClaims().size());
+
+  mgr.clearClaims();
+  EXPECT_TRUE(mgr.getClaims().empty());
+
+  // Claiming again after clearing only reports the newly claimed resources
+  mgr.getHandle(h2.getName());
+  set<string> claims = mgr.getClaims();
+  ASSERT_EQ(1, claims.size());
+  EXPECT_EQ(h2.getName(), *claims.begin());
+
+  // Copies keep the claims of the original
+  HardwareResourceManager<HandleType, ClaimResources> mgr_copy(mgr);
+  EXPECT_EQ(claims, mgr_copy.getClaims());
+  mgr_copy.clearClaims();
+  EXPECT_TRUE(mgr_copy.getClaims().empty());
+  EXPECT_EQ(claims, mgr.getClaims());
+}
+
+TEST_F(HardwareResourceManagerTest, ClaimIds)
+{
+  HardwareResourceManager<HandleType, ClaimResources> mgr1;
+  HardwareResourceManager<HandleType, ClaimResources> mgr2;
+  mgr1.registerHandle(h1);
+  mgr1.registerHandle(h2);
+  mgr2.registerHandle(h1);
+
+  // The same resource has the same id in all interfaces
+  mgr1.getHandle(h1.getName());
+  mgr2.getHandle(h1.getName());
+  EXPECT_EQ(mgr1.getClaimIds(), mgr2.getClaimIds());
+
+  size_t id1;
+  ASSERT_TRUE(internal::ResourceIds::findId(h1.getName(), id1));
+  EXPECT_EQ(h1.getName(), internal::ResourceIds::getName(id1));
+  size_t id;
+  EXPECT_FALSE(internal::ResourceIds::findId("never_claimed", id));
+
+  // Interface resources built from claim ids resolve to the claimed names
+  mgr1.getHandle(h2.getName());
+  InterfaceResources iface_res("iface", mgr1.getClaimIds());
+  EXPECT_TRUE(iface_res.hasResource(id1));
+  EXPECT_EQ(mgr1.getClaims(), iface_res.getResources());
+  EXPECT_EQ(mgr1.getClaims(), iface_res.resources);
+
+  // ...and so do interface resources built from names
+  InterfaceResources iface_res_names("iface", mgr1.getClaims());
+  EXPECT_EQ(mgr1.getClaims(), iface_res_names.getResources());
+  EXPECT_EQ(mgr1.getClaims(), iface_res_names.resources);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
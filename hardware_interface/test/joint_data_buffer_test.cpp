@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ros/console.h>
+#include <hardware_interface/joint_data_buffer.h>
+
+using std::string;
+using std::vector;
+using namespace hardware_interface;
+
+TEST(AlignedArraysTest, Layout)
+{
+  internal::AlignedArrays arrays(3, 5, 1.0);
+  EXPECT_EQ(3, arrays.numArrays());
+  EXPECT_EQ(5, arrays.size());
+
+  for (std::size_t i = 0; i < arrays.numArrays(); ++i)
+  {
+    // Arrays start on a cache line and do not overlap
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(arrays.data(i)) % internal::CACHE_LINE_SIZE);
+    if (i > 0) {EXPECT_GE(arrays.data(i), arrays.data(i - 1) + arrays.size());}
+    for (std::size_t j = 0; j < arrays.size(); ++j) {EXPECT_DOUBLE_EQ(1.0, arrays.data(i)[j]);}
+  }
+
+  // Copies have their own, aligned storage
+  arrays.data(1)[2] = 2.0;
+  internal::AlignedArrays arrays_copy(arrays);
+  EXPECT_NE(arrays.data(0), arrays_copy.data(0));
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(arrays_copy.data(0)) % internal::CACHE_LINE_SIZE);
+  EXPECT_DOUBLE_EQ(2.0, arrays_copy.data(1)[2]);
+}
+
+class JointDataBufferTest : public ::testing::Test
+{
+public:
+  JointDataBufferTest()
+  {
+    names.push_back("joint_1");
+    names.push_back("joint_2");
+    names.push_back("joint_3");
+  }
+
+protected:
+  vector<string> names;
+};
+
+TEST_F(JointDataBufferTest, ExcerciseApi)
+{
+  JointDataBuffer buffer(names);
+  ASSERT_EQ(names.size(), buffer.size());
+  EXPECT_EQ(names, buffer.getNames());
+
+  for (std::size_t i = 0; i < names.size(); ++i) {EXPECT_EQ(i, buffer.getIndex(names[i]));}
+  EXPECT_THROW(buffer.getIndex("unknown_name"), HardwareInterfaceException);
+
+  // Data is initially unset
+  EXPECT_TRUE(std::isnan(buffer.getPositions()[0]));
+  EXPECT_TRUE(std::isnan(buffer.getCommands()[0]));
+
+  // Data arrays are contiguous and aligned to cache lines
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(buffer.getPositions())  % internal::CACHE_LINE_SIZE);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(buffer.getVelocities()) % internal::CACHE_LINE_SIZE);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(buffer.getEfforts())    % internal::CACHE_LINE_SIZE);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(buffer.getCommands())   % internal::CACHE_LINE_SIZE);
+
+  // Handles point to the buffer data
+  for (std::size_t i = 0; i < buffer.size(); ++i)
+  {
+    buffer.getPositions()[i]  = 1.0 * i;
+    buffer.getVelocities()[i] = 2.0 * i;
+    buffer.getEfforts()[i]    = 3.0 * i;
+  }
+
+  JointHandle h = buffer.getCommandHandle(1);
+  EXPECT_EQ(names[1], h.getName());
+  EXPECT_DOUBLE_EQ(1.0, h.getPosition());
+  EXPECT_DOUBLE_EQ(2.0, h.getVelocity());
+  EXPECT_DOUBLE_EQ(3.0, h.getEffort());
+  h.setCommand(4.0);
+  EXPECT_DOUBLE_EQ(4.0, buffer.getCommands()[1]);
+}
+
+TEST_F(JointDataBufferTest, DuplicateNames)
+{
+  names.push_back(names.front());
+  EXPECT_THROW(JointDataBuffer buffer(names), HardwareInterfaceException);
+}
+
+TEST_F(JointDataBufferTest, RegisterHandles)
+{
+  JointDataBuffer buffer(names);
+
+  JointStateInterface state_iface;
+  buffer.registerHandles(state_iface);
+  EXPECT_EQ(names.size(), state_iface.getNames().size());
+
+  PositionJointInterface pos_iface;
+  buffer.registerHandles(pos_iface);
+  EXPECT_EQ(names.size(), pos_iface.getNames().size());
+
+  JointHandle h = pos_iface.getHandle(names[2]);
+  EXPECT_EQ(buffer.getPositions() + 2, h.getPositionPtr());
+  EXPECT_EQ(buffer.getCommands()  + 2, h.getCommandPtr());
+
+  h.setCommand(-1.0);
+  EXPECT_DOUBLE_EQ(-1.0, buffer.getCommands()[2]);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
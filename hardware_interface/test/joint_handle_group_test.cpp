@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ros/console.h>
+#include <hardware_interface/joint_data_buffer.h>
+#include <hardware_interface/joint_handle_group.h>
+
+using std::string;
+using std::vector;
+using namespace hardware_interface;
+
+class JointHandleGroupTest : public ::testing::Test
+{
+public:
+  JointHandleGroupTest()
+  {
+    names.push_back("joint_1");
+    names.push_back("joint_2");
+    names.push_back("joint_3");
+
+    // Data not contiguous in memory
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      pos[i] = 1.0 + i; vel[2 * i] = 2.0 + i; eff[i] = 3.0 + i; cmd[i] = 0.0;
+      JointStateHandle jsh(names[i], &pos[i], &vel[2 * i], &eff[i]);
+      iface.registerHandle(JointHandle(jsh, &cmd[i]));
+    }
+  }
+
+protected:
+  vector<string> names;
+  double pos[3], vel[6], eff[3], cmd[3];
+  PositionJointInterface iface;
+};
+
+TEST_F(JointHandleGroupTest, HandleNotFound)
+{
+  vector<string> bad_names = names;
+  bad_names.push_back("unknown_name");
+  EXPECT_THROW(JointHandleGroup(iface, bad_names), HardwareInterfaceException);
+}
+
+TEST_F(JointHandleGroupTest, ClaimResources)
+{
+  vector<string> some_names(names.begin(), names.begin() + 2);
+  JointHandleGroup group(iface, some_names);
+  ASSERT_EQ(2, group.size());
+  EXPECT_EQ(2, iface.getClaims().size());
+  EXPECT_EQ(1, iface.getClaims().count(names[0]));
+  EXPECT_EQ(1, iface.getClaims().count(names[1]));
+  EXPECT_EQ(names[1], group.getHandle(1).getName());
+}
+
+TEST_F(JointHandleGroupTest, GatherScatter)
+{
+  // Joint order in the group differs from registration order
+  vector<string> group_names;
+  group_names.push_back(names[2]);
+  group_names.push_back(names[0]);
+  group_names.push_back(names[1]);
+  JointHandleGroup group(iface, group_names);
+
+  EXPECT_FALSE(group.getPositionsPtr());
+  EXPECT_FALSE(group.getVelocitiesPtr());
+  EXPECT_FALSE(group.getCommandsPtr());
+
+  vector<double> data(group.size());
+  group.getPositions(&data[0]);
+  EXPECT_DOUBLE_EQ(pos[2], data[0]);
+  EXPECT_DOUBLE_EQ(pos[0], data[1]);
+  EXPECT_DOUBLE_EQ(pos[1], data[2]);
+
+  group.getVelocities(&data[0]);
+  EXPECT_DOUBLE_EQ(vel[4], data[0]);
+  EXPECT_DOUBLE_EQ(vel[0], data[1]);
+  EXPECT_DOUBLE_EQ(vel[2], data[2]);
+
+  group.getEfforts(&data[0]);
+  EXPECT_DOUBLE_EQ(eff[2], data[0]);
+  EXPECT_DOUBLE_EQ(eff[0], data[1]);
+  EXPECT_DOUBLE_EQ(eff[1], data[2]);
+
+  const double new_cmd[] = {10.0, 20.0, 30.0};
+  group.setCommands(new_cmd);
+  EXPECT_DOUBLE_EQ(10.0, cmd[2]);
+  EXPECT_DOUBLE_EQ(20.0, cmd[0]);
+  EXPECT_DOUBLE_EQ(30.0, cmd[1]);
+
+  group.getCommands(&data[0]);
+  EXPECT_DOUBLE_EQ(10.0, data[0]);
+  EXPECT_DOUBLE_EQ(20.0, data[1]);
+  EXPECT_DOUBLE_EQ(30.0, data[2]);
+}
+
+TEST_F(JointHandleGroupTest, ContiguousData)
+{
+  JointDataBuffer buffer(names);
+  EffortJointInterface buffer_iface;
+  buffer.registerHandles(buffer_iface);
+  for (std::size_t i = 0; i < buffer.size(); ++i) {buffer.getPositions()[i] = 1.0 + i;}
+
+  JointHandleGroup group(buffer_iface, names);
+  EXPECT_EQ(buffer.getPositions(),  group.getPositionsPtr());
+  EXPECT_EQ(buffer.getVelocities(), group.getVelocitiesPtr());
+  EXPECT_EQ(buffer.getEfforts(),    group.getEffortsPtr());
+  EXPECT_EQ(buffer.getCommands(),   group.getCommandsPtr());
+
+  vector<double> data(group.size());
+  group.getPositions(&data[0]);
+  for (std::size_t i = 0; i < data.size(); ++i) {EXPECT_DOUBLE_EQ(1.0 + i, data[i]);}
+
+  const double new_cmd[] = {-1.0, -2.0, -3.0};
+  group.setCommands(new_cmd);
+  for (std::size_t i = 0; i < buffer.size(); ++i) {EXPECT_DOUBLE_EQ(new_cmd[i], buffer.getCommands()[i]);}
+
+  // A subset out of order is not contiguous, but still works
+  vector<string> reversed_names(names.rbegin(), names.rend());
+  JointHandleGroup reversed_group(buffer_iface, reversed_names);
+  EXPECT_FALSE(reversed_group.getPositionsPtr());
+  reversed_group.getCommands(&data[0]);
+  for (std::size_t i = 0; i < data.size(); ++i) {EXPECT_DOUBLE_EQ(new_cmd[2 - i], data[i]);}
+}
+
+TEST_F(JointHandleGroupTest, EmptyGroup)
+{
+  JointHandleGroup group(iface, vector<string>());
+  EXPECT_EQ(0, group.size());
+  EXPECT_FALSE(group.getPositionsPtr());
+
+  // Zero-length buffers are left untouched
+  double guard = 1.0;
+  group.setCommands(&guard);
+  group.getPositions(&guard);
+  EXPECT_DOUBLE_EQ(1.0, guard);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
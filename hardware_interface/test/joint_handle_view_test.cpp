@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <ros/console.h>
+#include <hardware_interface/joint_handle_view.h>
+
+using namespace hardware_interface;
+
+class JointHandleViewTest : public ::testing::Test
+{
+public:
+  JointHandleViewTest()
+    : pos(1.0), vel(2.0), eff(3.0), cmd(0.0),
+      state_handle("joint_1", &pos, &vel, &eff),
+      handle(state_handle, &cmd)
+  {}
+
+protected:
+  double pos, vel, eff, cmd;
+  JointStateHandle state_handle;
+  JointHandle handle;
+};
+
+TEST_F(JointHandleViewTest, Size)
+{
+  EXPECT_EQ(1 * sizeof(double*), sizeof(JointPositionView));
+  EXPECT_EQ(1 * sizeof(double*), sizeof(JointCommandView));
+  EXPECT_EQ(2 * sizeof(double*), sizeof(JointPositionCommandView));
+  EXPECT_EQ(3 * sizeof(double*), sizeof(JointStateView));
+}
+
+TEST_F(JointHandleViewTest, StateViews)
+{
+  JointPositionView pos_view(state_handle);
+  EXPECT_DOUBLE_EQ(pos, pos_view.getPosition());
+  EXPECT_EQ(&pos, pos_view.getPositionPtr());
+
+  JointStateView state_view(handle);
+  EXPECT_DOUBLE_EQ(pos, state_view.getPosition());
+  EXPECT_DOUBLE_EQ(vel, state_view.getVelocity());
+  EXPECT_DOUBLE_EQ(eff, state_view.getEffort());
+
+  // Views track changes in the underlying data
+  pos = -1.0;
+  EXPECT_DOUBLE_EQ(-1.0, pos_view.getPosition());
+  EXPECT_DOUBLE_EQ(-1.0, state_view.getPosition());
+}
+
+TEST_F(JointHandleViewTest, CommandViews)
+{
+  JointCommandView cmd_view(handle);
+  cmd_view.setCommand(1.5);
+  EXPECT_DOUBLE_EQ(1.5, cmd);
+  EXPECT_DOUBLE_EQ(1.5, cmd_view.getCommand());
+  EXPECT_EQ(&cmd, cmd_view.getCommandPtr());
+
+  JointPositionCommandView pos_cmd_view(handle);
+  pos_cmd_view.setCommand(pos_cmd_view.getPosition() + 1.0);
+  EXPECT_DOUBLE_EQ(pos + 1.0, cmd);
+}
+
+TEST_F(JointHandleViewTest, FromInterface)
+{
+  VelocityJointInterface iface;
+  iface.registerHandle(handle);
+
+  JointPositionCommandView view(iface.getHandle("joint_1"));
+  EXPECT_EQ(1, iface.getClaims().size());
+  view.setCommand(2.0);
+  EXPECT_DOUBLE_EQ(2.0, cmd);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -61,6 +61,8 @@ TEST(JointStateHandleTest, AssertionTriggering)
   EXPECT_DEATH(h.getEffort(),     ".*");
   EXPECT_DEATH(h.getCommandPosition(),     ".*");
   EXPECT_DEATH(h.getCommandVelocity(),     ".*");
+  EXPECT_DEATH(h.getCommandPositionPtr(),  ".*");
+  EXPECT_DEATH(h.getCommandVelocityPtr(),  ".*");
   EXPECT_DEATH(h.setCommandPosition(2.0),     ".*");
   EXPECT_DEATH(h.setCommandVelocity(3.0),     ".*");
   EXPECT_DEATH(h.setCommand(1.0, 2.0), ".*");
@@ -109,6 +111,8 @@ TEST_F(PosVelCommandInterfaceTest, ExcerciseApi)
   EXPECT_DOUBLE_EQ(eff1, hc1_tmp.getEffort());
   EXPECT_DOUBLE_EQ(cmd_pos1, hc1_tmp.getCommandPosition());
   EXPECT_DOUBLE_EQ(cmd_vel1, hc1_tmp.getCommandVelocity());
+  EXPECT_EQ(&cmd_pos1, hc1_tmp.getCommandPositionPtr());
+  EXPECT_EQ(&cmd_vel1, hc1_tmp.getCommandVelocityPtr());
   const double new_cmd_pos1 = -1.0, new_cmd_vel1 = -2.0;
   hc1_tmp.setCommand(new_cmd_pos1, new_cmd_vel1);
   EXPECT_DOUBLE_EQ(new_cmd_pos1, hc1_tmp.getCommandPosition());
@@ -63,6 +63,7 @@ TEST(JointStateHandleTest, AssertionTriggering)
   EXPECT_DEATH(h.getCommandPosition(),     ".*");
   EXPECT_DEATH(h.getCommandVelocity(),     ".*");
   EXPECT_DEATH(h.getCommandAcceleration(), ".*");
+  EXPECT_DEATH(h.getCommandAccelerationPtr(), ".*");
   EXPECT_DEATH(h.setCommandPosition(2.0),     ".*");
   EXPECT_DEATH(h.setCommandVelocity(3.0),     ".*");
   EXPECT_DEATH(h.setCommandAcceleration(4.0), ".*");
@@ -113,6 +114,7 @@ TEST_F(PosVelAccCommandInterfaceTest, ExcerciseApi)
   EXPECT_DOUBLE_EQ(cmd_pos1, hc1_tmp.getCommandPosition());
   EXPECT_DOUBLE_EQ(cmd_vel1, hc1_tmp.getCommandVelocity());
   EXPECT_DOUBLE_EQ(cmd_acc1, hc1_tmp.getCommandAcceleration());
+  EXPECT_EQ(&cmd_acc1, hc1_tmp.getCommandAccelerationPtr());
   const double new_cmd_pos1 = -1.0, new_cmd_vel1 = -2.0, new_cmd_acc1 = -3.0;
   hc1_tmp.setCommand(new_cmd_pos1, new_cmd_vel1, new_cmd_acc1);
   EXPECT_DOUBLE_EQ(new_cmd_pos1, hc1_tmp.getCommandPosition());
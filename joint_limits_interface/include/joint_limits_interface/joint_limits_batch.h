@@ -0,0 +1,538 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef JOINT_LIMITS_INTERFACE_JOINT_LIMITS_BATCH_H
+#define JOINT_LIMITS_INTERFACE_JOINT_LIMITS_BATCH_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ros/duration.h>
+
+#include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/posvel_command_interface.h>
+#include <hardware_interface/posvelacc_command_interface.h>
+
+#include <joint_limits_interface/joint_limits.h>
+#include <joint_limits_interface/joint_limits_interface.h>
+#include <joint_limits_interface/joint_limits_interface_exception.h>
+
+namespace joint_limits_interface
+{
+
+namespace internal
+{
+
+/** \return Command pointer of \p jh. Throws if \p jh is not bound to a joint, eg. if default-constructed. */
+inline double* commandPtr(const hardware_interface::JointHandle& jh)
+{
+  hardware_interface::JointHandle handle = jh;
+  if (handle.getName().empty())
+  {
+    throw JointLimitsInterfaceException("Cannot enforce limits of a joint handle that is not bound to a joint.");
+  }
+  return handle.getCommandPtr();
+}
+
+} // namespace
+
+/**
+ * \brief Engine for enforcing the limits of a set of position-controlled joints in a single pass.
+ *
+ * Equivalent to a \ref PositionJointSaturationInterface, but instead of visiting one \ref PositionJointSaturationHandle
+ * per joint, it stores the limits and previous commands of all joints in contiguous arrays, and enforces them in three
+ * steps: gather the commands into a contiguous buffer, saturate them in a branch-free loop that the compiler can
+ * vectorize, and scatter the results back to the joints. Bounds are computed for all joints, and those of missing limits
+ * are discarded with a select rather than a branch.
+ *
+ * Results are identical to those obtained with \ref PositionJointSaturationHandle, as the same floating point operations
+ * are performed in the same order. The only exception is when the compiler is allowed to fuse multiply-adds (eg. GCC's
+ * default \c -ffp-contract=fast on targets with FMA instructions), as it may fuse the computation of the velocity
+ * bounds differently in both implementations. Bounds then differ by at most one rounding error, ie. a relative error
+ * below 1e-15.
+ *
+ * \note The lifecycle of the joint data pointed to by the handles is not handled by this class.
+ */
+class PositionJointSaturationBatch
+{
+public:
+  /** \return Number of joints in the batch. */
+  std::size_t size() const {return cmd_ptrs_.size();}
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a joint to the batch.
+   * \param jh Handle of the joint whose command will be saturated.
+   * \param limits Joint limits specification.
+   */
+  void addJoint(const hardware_interface::JointHandle& jh, const JointLimits& limits)
+  {
+    double* cmd_ptr = internal::commandPtr(jh);
+    const double* pos_ptr = jh.getPositionPtr();
+
+    cmd_ptrs_.push_back(cmd_ptr);
+    pos_ptrs_.push_back(pos_ptr);
+    min_pos_.push_back(limits.has_position_limits ? limits.min_position : -std::numeric_limits<double>::max());
+    max_pos_.push_back(limits.has_position_limits ? limits.max_position :  std::numeric_limits<double>::max());
+    has_vel_.push_back(limits.has_velocity_limits ? 1.0 : 0.0);
+    max_vel_.push_back(limits.has_velocity_limits ? limits.max_velocity : 0.0);
+    prev_cmd_.push_back(std::numeric_limits<double>::quiet_NaN());
+    cmd_.push_back(0.0);
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Enforce position and velocity limits of all joints. \sa PositionJointSaturationHandle::enforceLimits
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      cmd_[i] = *cmd_ptrs_[i];
+      if (std::isnan(prev_cmd_[i])) {prev_cmd_[i] = *pos_ptrs_[i];}
+    }
+
+    const double dt = period.toSec();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const double delta_pos = max_vel_[i] * dt;
+      const double min_pos   = std::max(prev_cmd_[i] - delta_pos, min_pos_[i]);
+      const double max_pos   = std::min(prev_cmd_[i] + delta_pos, max_pos_[i]);
+      const bool   has_vel   = has_vel_[i] != 0.0; // Selected rather than branched on
+      cmd_[i]      = internal::saturate(cmd_[i], has_vel ? min_pos : min_pos_[i], has_vel ? max_pos : max_pos_[i]);
+      prev_cmd_[i] = cmd_[i];
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {*cmd_ptrs_[i] = cmd_[i];}
+  }
+
+  /** \brief Reset state of all joints, in case of mode switch or e-stop. */
+  void reset()
+  {
+    std::fill(prev_cmd_.begin(), prev_cmd_.end(), std::numeric_limits<double>::quiet_NaN());
+  }
+
+  /*\}*/
+
+private:
+  std::vector<double*>       cmd_ptrs_;
+  std::vector<const double*> pos_ptrs_;
+  std::vector<double>        min_pos_;
+  std::vector<double>        max_pos_;
+  std::vector<double>        has_vel_; ///< 1.0 if the joint has velocity limits, 0.0 otherwise
+  std::vector<double>        max_vel_;
+  std::vector<double>        prev_cmd_;
+  std::vector<double>        cmd_;     ///< Gathered commands, saturated in place before being scattered
+};
+
+/**
+ * \brief Engine for enforcing the limits of a set of velocity-controlled joints in a single pass.
+ *
+ * Batch counterpart of \ref VelocityJointSaturationHandle, with the same structure as
+ * \ref PositionJointSaturationBatch. Results are identical to those of the handle, with the same caveat on fused
+ * multiply-adds.
+ */
+class VelocityJointSaturationBatch
+{
+public:
+  /** \return Number of joints in the batch. */
+  std::size_t size() const {return cmd_ptrs_.size();}
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a joint to the batch.
+   * \param jh Handle of the joint whose command will be saturated.
+   * \param limits Joint limits specification. Must contain velocity limits, otherwise an exception is thrown.
+   */
+  void addJoint(const hardware_interface::JointHandle& jh, const JointLimits& limits)
+  {
+    VelocityJointSaturationHandle(jh, limits); // Validates limits
+    cmd_ptrs_.push_back(internal::commandPtr(jh));
+    max_vel_.push_back(limits.max_velocity);
+    has_acc_.push_back(limits.has_acceleration_limits ? 1.0 : 0.0);
+    max_acc_.push_back(limits.has_acceleration_limits ? limits.max_acceleration : 0.0);
+    prev_cmd_.push_back(0.0);
+    cmd_.push_back(0.0);
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Enforce velocity and acceleration limits of all joints. \sa VelocityJointSaturationHandle::enforceLimits
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i) {cmd_[i] = *cmd_ptrs_[i];}
+
+    const double dt = period.toSec();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const double vel_low  = std::max(prev_cmd_[i] - max_acc_[i] * dt, -max_vel_[i]);
+      const double vel_high = std::min(prev_cmd_[i] + max_acc_[i] * dt,  max_vel_[i]);
+      const bool   has_acc  = has_acc_[i] != 0.0; // Selected rather than branched on
+      cmd_[i]      = internal::saturate(cmd_[i], has_acc ? vel_low : -max_vel_[i], has_acc ? vel_high : max_vel_[i]);
+      prev_cmd_[i] = cmd_[i];
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {*cmd_ptrs_[i] = cmd_[i];}
+  }
+
+  /*\}*/
+
+private:
+  std::vector<double*> cmd_ptrs_;
+  std::vector<double>  max_vel_;
+  std::vector<double>  has_acc_; ///< 1.0 if the joint has acceleration limits, 0.0 otherwise
+  std::vector<double>  max_acc_;
+  std::vector<double>  prev_cmd_;
+  std::vector<double>  cmd_;     ///< Gathered commands, saturated in place before being scattered
+};
+
+/**
+ * \brief Engine for enforcing the limits of a set of effort-controlled joints in a single pass.
+ *
+ * Batch counterpart of \ref EffortJointSaturationHandle, with the same structure as
+ * \ref PositionJointSaturationBatch. Results are identical to those of the handle.
+ */
+class EffortJointSaturationBatch
+{
+public:
+  /** \return Number of joints in the batch. */
+  std::size_t size() const {return cmd_ptrs_.size();}
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a joint to the batch.
+   * \param jh Handle of the joint whose command will be saturated.
+   * \param limits Joint limits specification. Must contain velocity and effort limits, otherwise an exception is
+   * thrown.
+   */
+  void addJoint(const hardware_interface::JointHandle& jh, const JointLimits& limits)
+  {
+    EffortJointSaturationHandle(jh, limits); // Validates limits
+    double* cmd_ptr = internal::commandPtr(jh);
+    const double* pos_ptr = jh.getPositionPtr();
+    const double* vel_ptr = jh.getVelocityPtr();
+
+    const double inf = std::numeric_limits<double>::infinity();
+    cmd_ptrs_.push_back(cmd_ptr);
+    pos_ptrs_.push_back(pos_ptr);
+    vel_ptrs_.push_back(vel_ptr);
+    min_pos_.push_back(limits.has_position_limits ? limits.min_position : -inf);
+    max_pos_.push_back(limits.has_position_limits ? limits.max_position :  inf);
+    max_vel_.push_back(limits.max_velocity);
+    max_eff_.push_back(limits.max_effort);
+    cmd_.push_back(0.0);
+    pos_.push_back(0.0);
+    vel_.push_back(0.0);
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /** \brief Enforce position, velocity and effort limits of all joints. \sa EffortJointSaturationHandle::enforceLimits */
+  void enforceLimits(const ros::Duration& /* period */)
+  {
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      cmd_[i] = *cmd_ptrs_[i];
+      pos_[i] = *pos_ptrs_[i];
+      vel_[i] = *vel_ptrs_[i];
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      // Same precedence as the handle: upper bounds are released only if lower bounds are not violated
+      const bool below_pos = pos_[i] < min_pos_[i];
+      const bool above_pos = !below_pos && pos_[i] > max_pos_[i];
+      const bool below_vel = vel_[i] < -max_vel_[i];
+      const bool above_vel = !below_vel && vel_[i] > max_vel_[i];
+      const double min_eff = (below_pos || below_vel) ? 0.0 : -max_eff_[i];
+      const double max_eff = (above_pos || above_vel) ? 0.0 :  max_eff_[i];
+      cmd_[i] = internal::saturate(cmd_[i], min_eff, max_eff);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {*cmd_ptrs_[i] = cmd_[i];}
+  }
+
+  /*\}*/
+
+private:
+  std::vector<double*>       cmd_ptrs_;
+  std::vector<const double*> pos_ptrs_;
+  std::vector<const double*> vel_ptrs_;
+  std::vector<double>        min_pos_; ///< Minus infinity if the joint has no position limits
+  std::vector<double>        max_pos_; ///< Infinity if the joint has no position limits
+  std::vector<double>        max_vel_;
+  std::vector<double>        max_eff_;
+  std::vector<double>        cmd_;     ///< Gathered commands, saturated in place before being scattered
+  std::vector<double>        pos_;     ///< Gathered positions
+  std::vector<double>        vel_;     ///< Gathered velocities
+};
+
+/**
+ * \brief Engine for enforcing the limits of a set of joints commanded by position and velocity in a single pass.
+ *
+ * Batch counterpart of \ref PosVelJointSaturationHandle, with the same structure as
+ * \ref PositionJointSaturationBatch. Results are identical to those of the handle, with the same caveat on fused
+ * multiply-adds.
+ */
+class PosVelJointSaturationBatch
+{
+public:
+  /** \return Number of joints in the batch. */
+  std::size_t size() const {return pos_cmd_ptrs_.size();}
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a joint to the batch.
+   * \param jh Handle of the joint whose commands will be saturated.
+   * \param limits Joint limits specification.
+   */
+  void addJoint(const hardware_interface::PosVelJointHandle& jh, const JointLimits& limits)
+  {
+    addPosVelJoint(jh, limits);
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits of all joints.
+   * \sa PosVelJointSaturationHandle::enforceLimits
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    enforcePosVelLimits(period.toSec());
+    scatterPosVel();
+  }
+
+  /** \brief Reset state of all joints, in case of mode switch or e-stop. */
+  void reset()
+  {
+    std::fill(prev_pos_cmd_.begin(), prev_pos_cmd_.end(), std::numeric_limits<double>::quiet_NaN());
+    std::fill(prev_vel_cmd_.begin(), prev_vel_cmd_.end(), 0.0);
+  }
+
+  /*\}*/
+
+protected:
+  std::vector<double> vel_cmd_;       ///< Saturated velocity commands of the last update, before being scattered
+  std::vector<double> max_vel_limit_; ///< Largest double if the joint has no velocity limits
+
+  void addPosVelJoint(const hardware_interface::PosVelJointHandle& jh, const JointLimits& limits)
+  {
+    if (jh.getName().empty())
+    {
+      throw JointLimitsInterfaceException("Cannot enforce limits of a joint handle that is not bound to a joint.");
+    }
+    hardware_interface::PosVelJointHandle handle = jh;
+
+    const double max = std::numeric_limits<double>::max();
+    pos_cmd_ptrs_.push_back(handle.getCommandPositionPtr());
+    vel_cmd_ptrs_.push_back(handle.getCommandVelocityPtr());
+    pos_ptrs_.push_back(jh.getPositionPtr());
+    min_pos_limit_.push_back(limits.has_position_limits ? limits.min_position : -max);
+    max_pos_limit_.push_back(limits.has_position_limits ? limits.max_position :  max);
+    has_vel_.push_back(limits.has_velocity_limits ? 1.0 : 0.0);
+    max_vel_limit_.push_back(limits.has_velocity_limits ? limits.max_velocity : max);
+    has_acc_.push_back(limits.has_acceleration_limits ? 1.0 : 0.0);
+    max_acc_.push_back(limits.has_acceleration_limits ? limits.max_acceleration : 0.0);
+    prev_pos_cmd_.push_back(std::numeric_limits<double>::quiet_NaN());
+    prev_vel_cmd_.push_back(0.0);
+    pos_cmd_.push_back(0.0);
+    vel_cmd_.push_back(0.0);
+  }
+
+  void enforcePosVelLimits(double dt)
+  {
+    assert(dt > 0.0);
+
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      pos_cmd_[i] = *pos_cmd_ptrs_[i];
+      vel_cmd_[i] = *vel_cmd_ptrs_[i];
+      if (std::isnan(prev_pos_cmd_[i])) {prev_pos_cmd_[i] = *pos_ptrs_[i];}
+    }
+
+    using internal::saturate;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      // Position, bounded by the velocity limits. Bounds of missing limits are selected rather than branched on
+      const double delta_pos = max_vel_limit_[i] * dt;
+      const double min_pos   = std::max(prev_pos_cmd_[i] - delta_pos, min_pos_limit_[i]);
+      const double max_pos   = std::min(prev_pos_cmd_[i] + delta_pos, max_pos_limit_[i]);
+      const bool   has_vel   = has_vel_[i] != 0.0;
+      const double pos_cmd   = saturate(pos_cmd_[i],
+                                        has_vel ? min_pos : min_pos_limit_[i],
+                                        has_vel ? max_pos : max_pos_limit_[i]);
+
+      // Velocity, bounded by the acceleration limits
+      const double delta_vel = max_acc_[i] * dt;
+      const double min_vel   = std::max(prev_vel_cmd_[i] - delta_vel, -max_vel_limit_[i]);
+      const double max_vel   = std::min(prev_vel_cmd_[i] + delta_vel,  max_vel_limit_[i]);
+      const bool   has_acc   = has_acc_[i] != 0.0;
+      double vel_cmd = saturate(vel_cmd_[i],
+                                has_acc ? min_vel : -max_vel_limit_[i],
+                                has_acc ? max_vel :  max_vel_limit_[i]);
+
+      // Velocity must not drive the joint beyond its position limits
+      vel_cmd = saturate(vel_cmd, (min_pos_limit_[i] - pos_cmd) / dt, (max_pos_limit_[i] - pos_cmd) / dt);
+
+      pos_cmd_[i] = prev_pos_cmd_[i] = pos_cmd;
+      vel_cmd_[i] = prev_vel_cmd_[i] = vel_cmd;
+    }
+  }
+
+  void scatterPosVel()
+  {
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      *pos_cmd_ptrs_[i] = pos_cmd_[i];
+      *vel_cmd_ptrs_[i] = vel_cmd_[i];
+    }
+  }
+
+private:
+  std::vector<double*>       pos_cmd_ptrs_;
+  std::vector<double*>       vel_cmd_ptrs_;
+  std::vector<const double*> pos_ptrs_;
+  std::vector<double>        min_pos_limit_;
+  std::vector<double>        max_pos_limit_;
+  std::vector<double>        has_vel_; ///< 1.0 if the joint has velocity limits, 0.0 otherwise
+  std::vector<double>        has_acc_; ///< 1.0 if the joint has acceleration limits, 0.0 otherwise
+  std::vector<double>        max_acc_;
+  std::vector<double>        prev_pos_cmd_;
+  std::vector<double>        prev_vel_cmd_;
+  std::vector<double>        pos_cmd_; ///< Saturated position commands of the last update, before being scattered
+};
+
+/**
+ * \brief Engine for enforcing the limits of a set of joints commanded by position, velocity and acceleration in a
+ * single pass.
+ *
+ * Batch counterpart of \ref PosVelAccJointSaturationHandle. Results are identical to those of the handle, with the
+ * same caveat on fused multiply-adds as \ref PositionJointSaturationBatch.
+ */
+class PosVelAccJointSaturationBatch : private PosVelJointSaturationBatch
+{
+public:
+  using PosVelJointSaturationBatch::size;
+  using PosVelJointSaturationBatch::reset;
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a joint to the batch.
+   * \param jh Handle of the joint whose commands will be saturated.
+   * \param limits Joint limits specification.
+   */
+  void addJoint(const hardware_interface::PosVelAccJointHandle& jh, const JointLimits& limits)
+  {
+    addPosVelJoint(jh, limits);
+    hardware_interface::PosVelAccJointHandle handle = jh;
+    acc_cmd_ptrs_.push_back(handle.getCommandAccelerationPtr());
+    max_acc_limit_.push_back(limits.has_acceleration_limits ? limits.max_acceleration
+                                                            : std::numeric_limits<double>::max());
+    acc_cmd_.push_back(0.0);
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits of all joints.
+   * \sa PosVelAccJointSaturationHandle::enforceLimits
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    const double dt = period.toSec();
+    enforcePosVelLimits(dt);
+
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i) {acc_cmd_[i] = *acc_cmd_ptrs_[i];}
+
+    using internal::saturate;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      // Acceleration must not drive the joint beyond its velocity limits
+      const double acc_cmd = saturate(acc_cmd_[i], -max_acc_limit_[i], max_acc_limit_[i]);
+      acc_cmd_[i] = saturate(acc_cmd,
+                             (-max_vel_limit_[i] - vel_cmd_[i]) / dt,
+                             ( max_vel_limit_[i] - vel_cmd_[i]) / dt);
+    }
+
+    scatterPosVel();
+    for (std::size_t i = 0; i < n; ++i) {*acc_cmd_ptrs_[i] = acc_cmd_[i];}
+  }
+
+  /*\}*/
+
+private:
+  std::vector<double*> acc_cmd_ptrs_;
+  std::vector<double>  max_acc_limit_; ///< Largest double if the joint has no acceleration limits
+  std::vector<double>  acc_cmd_;       ///< Saturated acceleration commands, before being scattered
+};
+
+} // namespace
+
+#endif // header guard
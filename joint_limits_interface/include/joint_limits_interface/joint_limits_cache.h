@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * \file
+ * \brief Binary cache of joint limits, to skip robot description parsing on process restarts.
+ *
+ * This header only provides the cache file primitives, see \ref joint_limits_interface::loadJointLimits in
+ * joint_limits_cache_loader.h for a helper that reads the cache and falls back to parsing.
+ */
+
+#ifndef JOINT_LIMITS_INTERFACE_JOINT_LIMITS_CACHE_H
+#define JOINT_LIMITS_INTERFACE_JOINT_LIMITS_CACHE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/internal/binary_cache.h>
+#include <joint_limits_interface/joint_limits.h>
+
+namespace joint_limits_interface
+{
+
+/// Identifier and version of the layout of joint limits cache files. Must change whenever the layout changes.
+const uint32_t JOINT_LIMITS_CACHE_FORMAT = 0x4a4c0001;
+
+/** \brief Cached limits of a single joint. */
+struct JointLimitsCacheEntry
+{
+  JointLimitsCacheEntry() : has_soft_limits(false) {}
+
+  std::string     name;
+  JointLimits     limits;
+  SoftJointLimits soft_limits;
+  bool            has_soft_limits;
+};
+
+/**
+ * \brief Key identifying the joint limits of a robot in a cache file.
+ *
+ * Joint limits are obtained from the robot description and the parameters below \p ns, so all of them enter the key:
+ * changing the robot description or retuning a single limit invalidates the cache.
+ * \param robot_description Robot description.
+ * \param ns Namespace of the joint limits parameters.
+ * \param params Canonical serialization of the joint limits parameters, eg. the \p toXml() output of the
+ * \p joint_limits namespace fetched as a single \p XmlRpcValue. Empty if there are no such parameters.
+ */
+inline uint64_t jointLimitsCacheKey(const std::string& robot_description,
+                                    const std::string& ns,
+                                    const std::string& params)
+{
+  using hardware_interface::internal::fnv1aHash;
+  // The separators keep eg. "ab" + "c" and "a" + "bc" apart
+  uint64_t hash = fnv1aHash(robot_description);
+  hash = fnv1aHash(ns, fnv1aHash("\0", 1, hash));
+  return fnv1aHash(params, fnv1aHash("\0", 1, hash));
+}
+
+/**
+ * \brief Store joint limits in a cache file.
+ * \param path Cache file path.
+ * \param key Key identifying the data \p entries were obtained from, see \ref jointLimitsCacheKey.
+ * \param entries Joint limits to store.
+ * \return True if successful.
+ */
+inline bool writeJointLimitsCache(const std::string&                        path,
+                                  uint64_t                                  key,
+                                  const std::vector<JointLimitsCacheEntry>& entries)
+{
+  hardware_interface::internal::BinaryCacheWriter writer;
+  writer.write(static_cast<uint32_t>(entries.size()));
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    const JointLimitsCacheEntry& entry = entries[i];
+    writer.write(entry.name);
+
+    writer.write(entry.limits.min_position);
+    writer.write(entry.limits.max_position);
+    writer.write(entry.limits.max_velocity);
+    writer.write(entry.limits.max_acceleration);
+    writer.write(entry.limits.max_jerk);
+    writer.write(entry.limits.max_effort);
+    writer.write(entry.limits.has_position_limits);
+    writer.write(entry.limits.has_velocity_limits);
+    writer.write(entry.limits.has_acceleration_limits);
+    writer.write(entry.limits.has_jerk_limits);
+    writer.write(entry.limits.has_effort_limits);
+    writer.write(entry.limits.angle_wraparound);
+
+    writer.write(entry.has_soft_limits);
+    writer.write(entry.soft_limits.min_position);
+    writer.write(entry.soft_limits.max_position);
+    writer.write(entry.soft_limits.k_position);
+    writer.write(entry.soft_limits.k_velocity);
+  }
+  return writer.save(path, JOINT_LIMITS_CACHE_FORMAT, key);
+}
+
+/**
+ * \brief Read joint limits from a cache file.
+ * \param path Cache file path.
+ * \param key Expected key of the cached data, see \ref jointLimitsCacheKey.
+ * \param[out] entries Cached joint limits. Left unchanged if reading fails.
+ * \return True if the cache file exists, is valid and matches \p key.
+ */
+inline bool readJointLimitsCache(const std::string&                  path,
+                                 uint64_t                            key,
+                                 std::vector<JointLimitsCacheEntry>& entries)
+{
+  hardware_interface::internal::BinaryCacheReader reader;
+  if (!reader.open(path, JOINT_LIMITS_CACHE_FORMAT, key)) {return false;}
+
+  uint32_t size = 0;
+  if (!reader.read(size)) {return false;}
+
+  std::vector<JointLimitsCacheEntry> cached_entries(size);
+  for (std::size_t i = 0; i < cached_entries.size(); ++i)
+  {
+    JointLimitsCacheEntry& entry = cached_entries[i];
+    const bool ok = reader.read(entry.name) &&
+                    reader.read(entry.limits.min_position) &&
+                    reader.read(entry.limits.max_position) &&
+                    reader.read(entry.limits.max_velocity) &&
+                    reader.read(entry.limits.max_acceleration) &&
+                    reader.read(entry.limits.max_jerk) &&
+                    reader.read(entry.limits.max_effort) &&
+                    reader.read(entry.limits.has_position_limits) &&
+                    reader.read(entry.limits.has_velocity_limits) &&
+                    reader.read(entry.limits.has_acceleration_limits) &&
+                    reader.read(entry.limits.has_jerk_limits) &&
+                    reader.read(entry.limits.has_effort_limits) &&
+                    reader.read(entry.limits.angle_wraparound) &&
+                    reader.read(entry.has_soft_limits) &&
+                    reader.read(entry.soft_limits.min_position) &&
+                    reader.read(entry.soft_limits.max_position) &&
+                    reader.read(entry.soft_limits.k_position) &&
+                    reader.read(entry.soft_limits.k_velocity);
+    if (!ok) {return false;}
+  }
+  if (!reader.atEnd()) {return false;}
+
+  entries.swap(cached_entries);
+  return true;
+}
+
+} // namespace
+
+#endif // header guard
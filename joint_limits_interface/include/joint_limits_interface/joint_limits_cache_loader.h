@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * \file
+ * \brief Loading of joint limits through the binary joint limits cache.
+ */
+
+#ifndef JOINT_LIMITS_INTERFACE_JOINT_LIMITS_CACHE_LOADER_H
+#define JOINT_LIMITS_INTERFACE_JOINT_LIMITS_CACHE_LOADER_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ros/ros.h>
+#include <urdf/model.h>
+#include <XmlRpcValue.h>
+
+#include <joint_limits_interface/joint_limits_cache.h>
+#include <joint_limits_interface/joint_limits_rosparam.h>
+#include <joint_limits_interface/joint_limits_urdf.h>
+
+namespace joint_limits_interface
+{
+
+/**
+ * \brief Get the limits of all joints of a robot, reading them from a cache file when it is up to date.
+ *
+ * Limits and soft limits are taken from the URDF robot description, and limits specified in the \p joint_limits
+ * namespace of \p nh overwrite them, as in \ref getJointLimits(const ros::NodeHandle&, std::map<std::string, JointLimits>&).
+ *
+ * The \p joint_limits namespace is always fetched, with a single parameter server query, because its values enter the
+ * cache key. A cache hit skips parsing the robot description. On a miss, the cache file is rewritten.
+ * \param[in] robot_description URDF robot description.
+ * \param[in] nh NodeHandle where the joint limits are specified.
+ * \param[in] cache_path Cache file path.
+ * \param[out] entries Limits of all joints with limits in the robot description or in the parameter server, sorted by
+ * joint name. Left unchanged on failure.
+ * \return True if successful, false if the robot description could not be parsed.
+ */
+inline bool loadJointLimits(const std::string&                  robot_description,
+                            const ros::NodeHandle&              nh,
+                            const std::string&                  cache_path,
+                            std::vector<JointLimitsCacheEntry>& entries)
+{
+  XmlRpc::XmlRpcValue params;
+  const bool has_params = nh.getParam("joint_limits", params) && params.getType() == XmlRpc::XmlRpcValue::TypeStruct;
+
+  const uint64_t key = jointLimitsCacheKey(robot_description, nh.getNamespace(), has_params ? params.toXml() : "");
+  if (readJointLimitsCache(cache_path, key, entries)) {return true;}
+
+  urdf::Model model;
+  if (!model.initString(robot_description))
+  {
+    ROS_ERROR_STREAM("Failed to parse robot description, could not load joint limits.");
+    return false;
+  }
+
+  std::map<std::string, JointLimits>     limits;
+  std::map<std::string, SoftJointLimits> soft_limits;
+  for (std::map<std::string, urdf::JointSharedPtr>::const_iterator it = model.joints_.begin();
+       it != model.joints_.end(); ++it)
+  {
+    JointLimits joint_limits;
+    if (getJointLimits(it->second, joint_limits)) {limits[it->first] = joint_limits;}
+
+    SoftJointLimits joint_soft_limits;
+    if (getSoftJointLimits(it->second, joint_soft_limits)) {soft_limits[it->first] = joint_soft_limits;}
+  }
+  if (has_params) {internal::getJointLimits(params, limits);}
+
+  std::vector<JointLimitsCacheEntry> loaded_entries;
+  loaded_entries.reserve(limits.size());
+  for (std::map<std::string, JointLimits>::const_iterator it = limits.begin(); it != limits.end(); ++it)
+  {
+    JointLimitsCacheEntry entry;
+    entry.name = it->first;
+    entry.limits = it->second;
+
+    std::map<std::string, SoftJointLimits>::const_iterator soft_it = soft_limits.find(it->first);
+    if (soft_it != soft_limits.end())
+    {
+      entry.soft_limits = soft_it->second;
+      entry.has_soft_limits = true;
+    }
+    loaded_entries.push_back(entry);
+  }
+
+  if (!writeJointLimitsCache(cache_path, key, loaded_entries))
+  {
+    ROS_WARN_STREAM("Could not write joint limits cache file '" << cache_path << "'.");
+  }
+  entries.swap(loaded_entries);
+  return true;
+}
+
+}
+
+#endif
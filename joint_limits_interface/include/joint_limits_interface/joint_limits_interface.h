@@ -40,6 +40,8 @@
 
 #include <hardware_interface/internal/resource_manager.h>
 #include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/posvel_command_interface.h>
+#include <hardware_interface/posvelacc_command_interface.h>
 
 #include <joint_limits_interface/joint_limits.h>
 #include <joint_limits_interface/joint_limits_interface_exception.h>
@@ -530,6 +532,553 @@ private:
   double max_vel_limit_;
 };
 
+/**
+ * \brief A handle used to enforce position, velocity, acceleration and jerk limits of a position-controlled joint that
+ * does not have soft limits.
+ *
+ * The velocity and acceleration of the joint are estimated from the previous position commands, in the same open-loop
+ * fashion as \ref PositionJointSoftLimitsHandle. Bounds are propagated one control period ahead: the jerk limit bounds
+ * the acceleration, which in turn bounds the velocity and the position command. Only the jerk limit is required.
+ *
+ * Limits are enforced greedily, without looking ahead, so the joint can reach its position or velocity limits with a
+ * non-zero velocity or acceleration. Position and velocity limits then take precedence over the acceleration and jerk
+ * limits: the command stops at the limit, and the estimated velocity and acceleration are reset accordingly, ie. the
+ * joint is assumed to be at rest at a position limit, and to move at constant velocity at a velocity limit.
+ *
+ * \note: This handle type is \e stateful. It stores the previous position command, velocity and acceleration. The
+ * joint is assumed to be at rest at its current position on the first update, and after a \ref reset.
+ */
+class PositionJointJerkSaturationHandle
+{
+public:
+  PositionJointJerkSaturationHandle(const hardware_interface::JointHandle& jh, const JointLimits& limits)
+    : jh_(jh),
+      limits_(limits)
+  {
+    if (!limits.has_jerk_limits)
+    {
+      throw JointLimitsInterfaceException("Cannot enforce limits for joint '" + getName() +
+                                           "'. It has no jerk limits specification.");
+    }
+
+    const double max = std::numeric_limits<double>::max();
+    min_pos_limit_ = limits_.has_position_limits     ? limits_.min_position     : -max;
+    max_pos_limit_ = limits_.has_position_limits     ? limits_.max_position     :  max;
+    max_vel_limit_ = limits_.has_velocity_limits     ? limits_.max_velocity     :  max;
+    max_acc_limit_ = limits_.has_acceleration_limits ? limits_.max_acceleration :  max;
+    reset();
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Enforce position, velocity, acceleration and jerk limits for a joint that is not subject to soft limits.
+   *
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    assert(period.toSec() > 0.0);
+
+    using internal::saturate;
+
+    if (std::isnan(prev_cmd_)) {prev_cmd_ = jh_.getPosition();} // Happens only at initialization and after resets
+
+    const double dt = period.toSec();
+
+    // Acceleration, velocity and position bounds. Bounds are saturated to the limits instead of being intersected with
+    // them, so they never invert, even if the estimated state leads beyond a limit
+    const double delta_acc = limits_.max_jerk * dt;
+    const double min_acc = saturate(prev_acc_ - delta_acc, -max_acc_limit_, max_acc_limit_);
+    const double max_acc = saturate(prev_acc_ + delta_acc, -max_acc_limit_, max_acc_limit_);
+
+    const double min_vel = saturate(prev_vel_ + min_acc * dt, -max_vel_limit_, max_vel_limit_);
+    const double max_vel = saturate(prev_vel_ + max_acc * dt, -max_vel_limit_, max_vel_limit_);
+
+    const double min_pos = saturate(prev_cmd_ + min_vel * dt, min_pos_limit_, max_pos_limit_);
+    const double max_pos = saturate(prev_cmd_ + max_vel * dt, min_pos_limit_, max_pos_limit_);
+
+    // Saturate position command according to bounds, and to position and velocity limits. The latter only matter if the
+    // previous command is out of the position limits, eg. on initialization
+    double cmd = saturate(jh_.getCommand(), min_pos, max_pos);
+    cmd = saturate(cmd, prev_cmd_ - max_vel_limit_ * dt, prev_cmd_ + max_vel_limit_ * dt);
+    cmd = saturate(cmd, min_pos_limit_, max_pos_limit_);
+    jh_.setCommand(cmd);
+
+    // Cache variables, estimated from the command actually sent
+    double vel = (cmd - prev_cmd_) / dt;
+    double acc = (vel - prev_vel_) / dt;
+    if (cmd == min_pos_limit_ || cmd == max_pos_limit_)
+    {
+      // Stopped at a position limit
+      vel = 0.0;
+      acc = 0.0;
+    }
+    else if ((cmd == max_pos && max_vel == max_vel_limit_) || (cmd == min_pos && min_vel == -max_vel_limit_))
+    {
+      // Moving at the velocity limit
+      vel = saturate(vel, -max_vel_limit_, max_vel_limit_);
+      acc = 0.0;
+    }
+    prev_acc_ = acc;
+    prev_vel_ = vel;
+    prev_cmd_ = cmd;
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset()
+  {
+    prev_cmd_ = std::numeric_limits<double>::quiet_NaN();
+    prev_vel_ = 0.0;
+    prev_acc_ = 0.0;
+  }
+
+private:
+  hardware_interface::JointHandle jh_;
+  JointLimits limits_;
+  double min_pos_limit_, max_pos_limit_, max_vel_limit_, max_acc_limit_;
+  double prev_cmd_, prev_vel_, prev_acc_;
+};
+
+/**
+ * \brief A handle used to enforce velocity, acceleration and jerk limits of a velocity-controlled joint.
+ *
+ * The acceleration of the joint is estimated from the previous velocity commands, and limits are enforced as in
+ * \ref PositionJointJerkSaturationHandle: velocity limits take precedence over the acceleration and jerk limits, and
+ * the joint is assumed to move at constant velocity at a velocity limit. Velocity and jerk limits are required,
+ * acceleration limits are optional.
+ *
+ * \note: This handle type is \e stateful. It stores the previous velocity command and acceleration. The joint is
+ * assumed to be at rest on the first update, and after a \ref reset.
+ */
+class VelocityJointJerkSaturationHandle
+{
+public:
+  VelocityJointJerkSaturationHandle(const hardware_interface::JointHandle& jh, const JointLimits& limits)
+    : jh_(jh),
+      limits_(limits)
+  {
+    if (!limits.has_velocity_limits)
+    {
+      throw JointLimitsInterfaceException("Cannot enforce limits for joint '" + getName() +
+                                           "'. It has no velocity limits specification.");
+    }
+    if (!limits.has_jerk_limits)
+    {
+      throw JointLimitsInterfaceException("Cannot enforce limits for joint '" + getName() +
+                                           "'. It has no jerk limits specification.");
+    }
+
+    max_acc_limit_ = limits_.has_acceleration_limits ? limits_.max_acceleration : std::numeric_limits<double>::max();
+    reset();
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Enforce joint velocity, acceleration and jerk limits.
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    assert(period.toSec() > 0.0);
+
+    using internal::saturate;
+
+    const double dt = period.toSec();
+
+    // Acceleration and velocity bounds, saturated to the limits so that they never invert
+    const double delta_acc = limits_.max_jerk * dt;
+    const double min_acc = saturate(prev_acc_ - delta_acc, -max_acc_limit_, max_acc_limit_);
+    const double max_acc = saturate(prev_acc_ + delta_acc, -max_acc_limit_, max_acc_limit_);
+
+    const double vel_low  = saturate(prev_cmd_ + min_acc * dt, -limits_.max_velocity, limits_.max_velocity);
+    const double vel_high = saturate(prev_cmd_ + max_acc * dt, -limits_.max_velocity, limits_.max_velocity);
+
+    // Saturate velocity command according to bounds
+    const double cmd = saturate(jh_.getCommand(), vel_low, vel_high);
+    jh_.setCommand(cmd);
+
+    // Cache variables, estimated from the command actually sent. The acceleration vanishes at the velocity limits
+    const bool at_limit = (cmd == -limits_.max_velocity || cmd == limits_.max_velocity);
+    prev_acc_ = at_limit ? 0.0 : (cmd - prev_cmd_) / dt;
+    prev_cmd_ = cmd;
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset()
+  {
+    prev_cmd_ = 0.0;
+    prev_acc_ = 0.0;
+  }
+
+private:
+  hardware_interface::JointHandle jh_;
+  JointLimits limits_;
+  double max_acc_limit_;
+  double prev_cmd_, prev_acc_;
+};
+
+/**
+ * \brief A handle used to enforce position, velocity and acceleration limits of a joint commanded by position and
+ * velocity, that does not have soft limits.
+ *
+ * The position command is saturated as in \ref PositionJointSaturationHandle. The velocity command is then saturated
+ * to the velocity limits and, if specified, to the acceleration limits with respect to the previous velocity command.
+ * Finally, it is made consistent with the position command: it cannot drive the joint beyond its position limits
+ * within one control period, so a position command at a limit comes with a velocity command of zero or pointing away
+ * from the limit. Consistency with position limits takes precedence over acceleration limits.
+ *
+ * No limits are required.
+ *
+ * \note: This handle type is \e stateful. It stores the previous position and velocity commands.
+ */
+class PosVelJointSaturationHandle
+{
+public:
+  PosVelJointSaturationHandle(const hardware_interface::PosVelJointHandle& jh, const JointLimits& limits)
+    : jh_(jh),
+      limits_(limits)
+  {
+    const double max = std::numeric_limits<double>::max();
+    min_pos_limit_ = limits_.has_position_limits ? limits_.min_position : -max;
+    max_pos_limit_ = limits_.has_position_limits ? limits_.max_position :  max;
+    max_vel_limit_ = limits_.has_velocity_limits ? limits_.max_velocity :  max;
+    reset();
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits for a joint that is not subject to soft limits.
+   *
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    assert(period.toSec() > 0.0);
+
+    using internal::saturate;
+
+    if (std::isnan(prev_pos_cmd_)) {prev_pos_cmd_ = jh_.getPosition();} // Happens only at initialization and resets
+
+    const double dt = period.toSec();
+
+    // Position bounds
+    double min_pos = min_pos_limit_;
+    double max_pos = max_pos_limit_;
+    if (limits_.has_velocity_limits)
+    {
+      const double delta_pos = limits_.max_velocity * dt;
+      min_pos = std::max(prev_pos_cmd_ - delta_pos, min_pos_limit_);
+      max_pos = std::min(prev_pos_cmd_ + delta_pos, max_pos_limit_);
+    }
+    const double pos_cmd = saturate(jh_.getCommandPosition(), min_pos, max_pos);
+
+    // Velocity bounds
+    double min_vel = -max_vel_limit_;
+    double max_vel =  max_vel_limit_;
+    if (limits_.has_acceleration_limits)
+    {
+      const double delta_vel = limits_.max_acceleration * dt;
+      min_vel = std::max(prev_vel_cmd_ - delta_vel, -max_vel_limit_);
+      max_vel = std::min(prev_vel_cmd_ + delta_vel,  max_vel_limit_);
+    }
+    double vel_cmd = saturate(jh_.getCommandVelocity(), min_vel, max_vel);
+
+    // Velocity must not drive the joint beyond its position limits
+    vel_cmd = saturate(vel_cmd, (min_pos_limit_ - pos_cmd) / dt, (max_pos_limit_ - pos_cmd) / dt);
+
+    jh_.setCommand(pos_cmd, vel_cmd);
+
+    // Cache variables
+    prev_pos_cmd_ = pos_cmd;
+    prev_vel_cmd_ = vel_cmd;
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset()
+  {
+    prev_pos_cmd_ = std::numeric_limits<double>::quiet_NaN();
+    prev_vel_cmd_ = 0.0;
+  }
+
+private:
+  hardware_interface::PosVelJointHandle jh_;
+  JointLimits limits_;
+  double min_pos_limit_, max_pos_limit_, max_vel_limit_;
+  double prev_pos_cmd_, prev_vel_cmd_;
+};
+
+/**
+ * \brief A handle used to enforce position, velocity and acceleration limits of a joint commanded by position,
+ * velocity and acceleration, that does not have soft limits.
+ *
+ * Position and velocity commands are saturated as in \ref PosVelJointSaturationHandle. The acceleration command is
+ * then saturated to the acceleration limits, if specified, and made consistent with the velocity command: it cannot
+ * drive the joint beyond its velocity limits within one control period.
+ *
+ * No limits are required.
+ *
+ * \note: This handle type is \e stateful. It stores the previous position and velocity commands.
+ */
+class PosVelAccJointSaturationHandle
+{
+public:
+  PosVelAccJointSaturationHandle(const hardware_interface::PosVelAccJointHandle& jh, const JointLimits& limits)
+    : jh_(jh),
+      pos_vel_handle_(jh, limits)
+  {
+    const double max = std::numeric_limits<double>::max();
+    max_vel_limit_ = limits.has_velocity_limits     ? limits.max_velocity     : max;
+    max_acc_limit_ = limits.has_acceleration_limits ? limits.max_acceleration : max;
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits for a joint that is not subject to soft limits.
+   *
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    using internal::saturate;
+
+    pos_vel_handle_.enforceLimits(period);
+
+    // Acceleration must not drive the joint beyond its velocity limits
+    const double dt      = period.toSec();
+    const double vel_cmd = jh_.getCommandVelocity();
+    double acc_cmd = saturate(jh_.getCommandAcceleration(), -max_acc_limit_, max_acc_limit_);
+    acc_cmd = saturate(acc_cmd, (-max_vel_limit_ - vel_cmd) / dt, (max_vel_limit_ - vel_cmd) / dt);
+    jh_.setCommandAcceleration(acc_cmd);
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset() {pos_vel_handle_.reset();}
+
+private:
+  hardware_interface::PosVelAccJointHandle jh_;
+  PosVelJointSaturationHandle pos_vel_handle_; ///< Shares command data with jh_
+  double max_vel_limit_, max_acc_limit_;
+};
+
+/**
+ * \brief A handle used to enforce position, velocity and acceleration limits of a joint commanded by position and
+ * velocity.
+ *
+ * The position command is limited as in \ref PositionJointSoftLimitsHandle: the velocity bounds derived from the soft
+ * limits and the current position estimate bound the position command. The velocity command is saturated to the same
+ * velocity bounds and, if specified, to the acceleration limits with respect to the previous velocity command. Finally,
+ * as in \ref PosVelJointSaturationHandle, it cannot drive the joint beyond its hard position limits within one control
+ * period.
+ *
+ * <b>Requisites</b>
+ * - Position (for non-continuous joints) and velocity limits specification.
+ * - Soft limits specification. The \c k_velocity parameter is \e not used.
+ *
+ * \note: This handle type is \e stateful. It stores the previous position and velocity commands.
+ */
+class PosVelJointSoftLimitsHandle
+{
+public:
+  PosVelJointSoftLimitsHandle(const hardware_interface::PosVelJointHandle& jh,
+                              const JointLimits&                           limits,
+                              const SoftJointLimits&                       soft_limits)
+    : jh_(jh),
+      limits_(limits),
+      soft_limits_(soft_limits)
+  {
+    if (!limits.has_velocity_limits)
+    {
+      throw JointLimitsInterfaceException("Cannot enforce limits for joint '" + getName() +
+                                           "'. It has no velocity limits specification.");
+    }
+
+    const double max = std::numeric_limits<double>::max();
+    min_pos_limit_ = limits_.has_position_limits ? limits_.min_position : -max;
+    max_pos_limit_ = limits_.has_position_limits ? limits_.max_position :  max;
+    reset();
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Get the velocity bounds enforced in the last call to \ref enforceLimits.
+   *
+   * Used to make acceleration commands consistent with velocity commands.
+   */
+  void getVelocityBounds(double& min_vel, double& max_vel) const
+  {
+    min_vel = soft_min_vel_;
+    max_vel = soft_max_vel_;
+  }
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits for a joint subject to soft limits.
+   *
+   * If the joint has no position limits (eg. a continuous joint), only velocity and acceleration limits will be
+   * enforced.
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    assert(period.toSec() > 0.0);
+
+    using internal::saturate;
+
+    if (std::isnan(prev_pos_cmd_)) {prev_pos_cmd_ = jh_.getPosition();} // Happens only at initialization and resets
+    const double pos = prev_pos_cmd_;
+    const double dt  = period.toSec();
+
+    // Velocity bounds
+    if (limits_.has_position_limits)
+    {
+      // Velocity bounds depend on the velocity limit and the proximity to the position limit
+      soft_min_vel_ = saturate(-soft_limits_.k_position * (pos - soft_limits_.min_position),
+                               -limits_.max_velocity,
+                                limits_.max_velocity);
+
+      soft_max_vel_ = saturate(-soft_limits_.k_position * (pos - soft_limits_.max_position),
+                               -limits_.max_velocity,
+                                limits_.max_velocity);
+    }
+    else
+    {
+      // No position limits, eg. continuous joints
+      soft_min_vel_ = -limits_.max_velocity;
+      soft_max_vel_ =  limits_.max_velocity;
+    }
+
+    // Position bounds
+    double pos_low  = pos + soft_min_vel_ * dt;
+    double pos_high = pos + soft_max_vel_ * dt;
+
+    if (limits_.has_position_limits)
+    {
+      // This extra measure safeguards against pathological cases, like when the soft limit lies beyond the hard limit
+      pos_low  = std::max(pos_low,  limits_.min_position);
+      pos_high = std::min(pos_high, limits_.max_position);
+    }
+    const double pos_cmd = saturate(jh_.getCommandPosition(), pos_low, pos_high);
+
+    // Velocity command
+    double vel_low  = soft_min_vel_;
+    double vel_high = soft_max_vel_;
+    if (limits_.has_acceleration_limits)
+    {
+      const double delta_vel = limits_.max_acceleration * dt;
+      vel_low  = std::max(prev_vel_cmd_ - delta_vel, vel_low);
+      vel_high = std::min(prev_vel_cmd_ + delta_vel, vel_high);
+    }
+    double vel_cmd = saturate(jh_.getCommandVelocity(), vel_low, vel_high);
+
+    // Velocity must not drive the joint beyond its position limits
+    vel_cmd = saturate(vel_cmd, (min_pos_limit_ - pos_cmd) / dt, (max_pos_limit_ - pos_cmd) / dt);
+
+    jh_.setCommand(pos_cmd, vel_cmd);
+
+    // Cache variables
+    prev_pos_cmd_ = pos_cmd;
+    prev_vel_cmd_ = vel_cmd;
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset()
+  {
+    prev_pos_cmd_ = std::numeric_limits<double>::quiet_NaN();
+    prev_vel_cmd_ = 0.0;
+    soft_min_vel_ = -limits_.max_velocity;
+    soft_max_vel_ =  limits_.max_velocity;
+  }
+
+private:
+  hardware_interface::PosVelJointHandle jh_;
+  JointLimits limits_;
+  SoftJointLimits soft_limits_;
+  double min_pos_limit_, max_pos_limit_;
+  double prev_pos_cmd_, prev_vel_cmd_;
+  double soft_min_vel_, soft_max_vel_; ///< Velocity bounds of the last update
+};
+
+/**
+ * \brief A handle used to enforce position, velocity and acceleration limits of a joint commanded by position,
+ * velocity and acceleration.
+ *
+ * Position and velocity commands are limited as in \ref PosVelJointSoftLimitsHandle. The acceleration command is
+ * then saturated to the acceleration limits, if specified, and made consistent with the velocity command: it cannot
+ * drive the joint beyond the soft velocity bounds within one control period.
+ *
+ * <b>Requisites</b>
+ * - Position (for non-continuous joints) and velocity limits specification.
+ * - Soft limits specification. The \c k_velocity parameter is \e not used.
+ *
+ * \note: This handle type is \e stateful. It stores the previous position and velocity commands.
+ */
+class PosVelAccJointSoftLimitsHandle
+{
+public:
+  PosVelAccJointSoftLimitsHandle(const hardware_interface::PosVelAccJointHandle& jh,
+                                 const JointLimits&                              limits,
+                                 const SoftJointLimits&                          soft_limits)
+    : jh_(jh),
+      pos_vel_handle_(jh, limits, soft_limits)
+  {
+    max_acc_limit_ = limits.has_acceleration_limits ? limits.max_acceleration : std::numeric_limits<double>::max();
+  }
+
+  /** \return Joint name. */
+  std::string getName() const {return jh_.getName();}
+
+  /**
+   * \brief Enforce position, velocity and acceleration limits for a joint subject to soft limits.
+   *
+   * \param period Control period.
+   */
+  void enforceLimits(const ros::Duration& period)
+  {
+    using internal::saturate;
+
+    pos_vel_handle_.enforceLimits(period);
+
+    // Acceleration must not drive the joint beyond its velocity bounds
+    double min_vel, max_vel;
+    pos_vel_handle_.getVelocityBounds(min_vel, max_vel);
+
+    const double dt      = period.toSec();
+    const double vel_cmd = jh_.getCommandVelocity();
+    double acc_cmd = saturate(jh_.getCommandAcceleration(), -max_acc_limit_, max_acc_limit_);
+    acc_cmd = saturate(acc_cmd, (min_vel - vel_cmd) / dt, (max_vel - vel_cmd) / dt);
+    jh_.setCommandAcceleration(acc_cmd);
+  }
+
+  /**
+   * \brief Reset state, in case of mode switch or e-stop
+   */
+  void reset() {pos_vel_handle_.reset();}
+
+private:
+  hardware_interface::PosVelAccJointHandle jh_;
+  PosVelJointSoftLimitsHandle pos_vel_handle_; ///< Shares command data with jh_
+  double max_acc_limit_;
+};
+
 /**
  * \brief Interface for enforcing joint limits.
  *
@@ -616,6 +1165,109 @@ class VelocityJointSaturationInterface : public JointLimitsInterface<VelocityJoi
 /** Interface for enforcing limits on a velocity-controlled joint with soft position limits. */
 class VelocityJointSoftLimitsInterface : public JointLimitsInterface<VelocityJointSoftLimitsHandle> {};
 
+/** Interface for enforcing limits on a joint commanded by position and velocity through saturation. */
+class PosVelJointSaturationInterface : public JointLimitsInterface<PosVelJointSaturationHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<PosVelJointSaturationHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
+/** Interface for enforcing limits on a joint commanded by position and velocity with soft position limits. */
+class PosVelJointSoftLimitsInterface : public JointLimitsInterface<PosVelJointSoftLimitsHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<PosVelJointSoftLimitsHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
+/** Interface for enforcing limits on a joint commanded by position, velocity and acceleration through saturation. */
+class PosVelAccJointSaturationInterface : public JointLimitsInterface<PosVelAccJointSaturationHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<PosVelAccJointSaturationHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
+/** Interface for enforcing limits on a joint commanded by position, velocity and acceleration with soft position
+    limits. */
+class PosVelAccJointSoftLimitsInterface : public JointLimitsInterface<PosVelAccJointSoftLimitsHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<PosVelAccJointSoftLimitsHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
+/** Interface for enforcing jerk limits on a position-controlled joint through saturation. */
+class PositionJointJerkSaturationInterface : public JointLimitsInterface<PositionJointJerkSaturationHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<PositionJointJerkSaturationHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
+/** Interface for enforcing jerk limits on a velocity-controlled joint through saturation. */
+class VelocityJointJerkSaturationInterface : public JointLimitsInterface<VelocityJointJerkSaturationHandle> {
+public:
+  /** \name Real-Time Safe Functions
+   *\{*/
+  /** \brief Reset all managed handles. */
+  void reset()
+  {
+    typedef hardware_interface::ResourceManager<VelocityJointJerkSaturationHandle>::ResourceMap::iterator ItratorType;
+    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      it->second.reset();
+    }
+  }
+  /*\}*/
+};
+
 }
 
 #endif
@@ -30,76 +30,59 @@
 #ifndef JOINT_LIMITS_INTERFACE_JOINT_LIMITS_ROSPARAM_H
 #define JOINT_LIMITS_INTERFACE_JOINT_LIMITS_ROSPARAM_H
 
+#include <map>
 #include <string>
 
 #include <ros/ros.h>
+#include <XmlRpcValue.h>
 #include <joint_limits_interface/joint_limits.h>
 
 namespace joint_limits_interface
 {
 
+namespace internal
+{
+
 /**
- * \brief Populate a JointLimits instance from the ROS parameter server.
- *
- * It is assumed that the following parameter structure is followed on the provided NodeHandle. Unspecified parameters
- * are simply not added to the joint limits specification.
- * \code
- * joint_limits:
- *   foo_joint:
- *     has_position_limits: true
- *     min_position: 0.0
- *     max_position: 1.0
- *     has_velocity_limits: true
- *     max_velocity: 2.0
- *     has_acceleration_limits: true
- *     max_acceleration: 5.0
- *     has_jerk_limits: true
- *     max_jerk: 100.0
- *     has_effort_limits: true
- *     max_effort: 20.0
- *   bar_joint:
- *     has_position_limits: false # Continuous joint
- *     has_velocity_limits: true
- *     max_velocity: 4.0
- * \endcode
- *
- * This specification is similar to the one used by <a href="http://moveit.ros.org/wiki/MoveIt!">MoveIt!</a>,
- * but additionally supports jerk and effort limits.
- *
- * \param[in] joint_name Name of joint whose limits are to be fetched.
- * \param[in] nh NodeHandle where the joint limits are specified.
- * \param[out] limits Where joint limit data gets written into. Limits specified in the parameter server will overwrite
- * existing values. Values in \p limits not specified in the parameter server remain unchanged.
- * \return True if a limits specification is found (ie. the \p joint_limits/joint_name parameter exists in \p nh), false otherwise.
+ * \brief Read a boolean member of an XmlRpc struct.
+ * \return True if \p value has a boolean member named \p name, false otherwise.
  */
-inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle& nh, JointLimits& limits)
+inline bool getMember(XmlRpc::XmlRpcValue& value, const std::string& name, bool& member)
 {
-  // Node handle scoped where the joint limits are defined
-  ros::NodeHandle limits_nh;
-  try
-  {
-    const std::string limits_namespace = "joint_limits/" + joint_name;
-    if (!nh.hasParam(limits_namespace))
-    {
-      ROS_DEBUG_STREAM("No joint limits specification found for joint '" << joint_name <<
-                       "' in the parameter server (namespace " << nh.getNamespace() + "/" + limits_namespace << ").");
-      return false;
-    }
-    limits_nh = ros::NodeHandle(nh, limits_namespace);
-  }
-  catch(const ros::InvalidNameException& ex)
+  if (!value.hasMember(name) || value[name].getType() != XmlRpc::XmlRpcValue::TypeBoolean) {return false;}
+  member = static_cast<bool&>(value[name]);
+  return true;
+}
+
+/**
+ * \brief Read a floating point member of an XmlRpc struct. Integer members are accepted as well.
+ * \return True if \p value has a numeric member named \p name, false otherwise.
+ */
+inline bool getMember(XmlRpc::XmlRpcValue& value, const std::string& name, double& member)
+{
+  if (!value.hasMember(name)) {return false;}
+  XmlRpc::XmlRpcValue& member_value = value[name];
+  switch (member_value.getType())
   {
-    ROS_ERROR_STREAM(ex.what());
-    return false;
+    case XmlRpc::XmlRpcValue::TypeDouble: member = static_cast<double&>(member_value); return true;
+    case XmlRpc::XmlRpcValue::TypeInt:    member = static_cast<int&>(member_value);    return true;
+    default: return false;
   }
+}
 
+/**
+ * \brief Populate a JointLimits instance from the limits specification of a single joint.
+ * \pre \p value is an XmlRpc struct.
+ */
+inline void getJointLimits(XmlRpc::XmlRpcValue& value, JointLimits& limits)
+{
   // Position limits
   bool has_position_limits = false;
-  if(limits_nh.getParam("has_position_limits", has_position_limits))
+  if(getMember(value, "has_position_limits", has_position_limits))
   {
     if (!has_position_limits) {limits.has_position_limits = false;}
     double min_pos, max_pos;
-    if (has_position_limits && limits_nh.getParam("min_position", min_pos) && limits_nh.getParam("max_position", max_pos))
+    if (has_position_limits && getMember(value, "min_position", min_pos) && getMember(value, "max_position", max_pos))
     {
       limits.has_position_limits = true;
       limits.min_position = min_pos;
@@ -107,7 +90,7 @@ inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle&
     }
 
     bool angle_wraparound;
-    if (!has_position_limits && limits_nh.getParam("angle_wraparound", angle_wraparound))
+    if (!has_position_limits && getMember(value, "angle_wraparound", angle_wraparound))
     {
       limits.angle_wraparound = angle_wraparound;
     }
@@ -115,11 +98,11 @@ inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle&
 
   // Velocity limits
   bool has_velocity_limits = false;
-  if(limits_nh.getParam("has_velocity_limits", has_velocity_limits))
+  if(getMember(value, "has_velocity_limits", has_velocity_limits))
   {
     if (!has_velocity_limits) {limits.has_velocity_limits = false;}
     double max_vel;
-    if (has_velocity_limits && limits_nh.getParam("max_velocity", max_vel))
+    if (has_velocity_limits && getMember(value, "max_velocity", max_vel))
     {
       limits.has_velocity_limits = true;
       limits.max_velocity = max_vel;
@@ -128,11 +111,11 @@ inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle&
 
   // Acceleration limits
   bool has_acceleration_limits = false;
-  if(limits_nh.getParam("has_acceleration_limits", has_acceleration_limits))
+  if(getMember(value, "has_acceleration_limits", has_acceleration_limits))
   {
     if (!has_acceleration_limits) {limits.has_acceleration_limits = false;}
     double max_acc;
-    if (has_acceleration_limits && limits_nh.getParam("max_acceleration", max_acc))
+    if (has_acceleration_limits && getMember(value, "max_acceleration", max_acc))
     {
       limits.has_acceleration_limits = true;
       limits.max_acceleration = max_acc;
@@ -141,11 +124,11 @@ inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle&
 
   // Jerk limits
   bool has_jerk_limits = false;
-  if(limits_nh.getParam("has_jerk_limits", has_jerk_limits))
+  if(getMember(value, "has_jerk_limits", has_jerk_limits))
   {
     if (!has_jerk_limits) {limits.has_jerk_limits = false;}
     double max_jerk;
-    if (has_jerk_limits && limits_nh.getParam("max_jerk", max_jerk))
+    if (has_jerk_limits && getMember(value, "max_jerk", max_jerk))
     {
       limits.has_jerk_limits = true;
       limits.max_jerk = max_jerk;
@@ -154,17 +137,128 @@ inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle&
 
   // Effort limits
   bool has_effort_limits = false;
-  if(limits_nh.getParam("has_effort_limits", has_effort_limits))
+  if(getMember(value, "has_effort_limits", has_effort_limits))
   {
     if (!has_effort_limits) {limits.has_effort_limits = false;}
     double max_effort;
-    if (has_effort_limits && limits_nh.getParam("max_effort", max_effort))
+    if (has_effort_limits && getMember(value, "max_effort", max_effort))
     {
       limits.has_effort_limits = true;
       limits.max_effort = max_effort;
     }
   }
+}
+
+/**
+ * \brief Populate JointLimits instances from the contents of a \p joint_limits namespace.
+ * \param[in] value Contents of the namespace.
+ * \param[out] limits Map from joint name to joint limits. Entries are added for joints without one.
+ * \pre \p value is an XmlRpc struct.
+ */
+inline void getJointLimits(XmlRpc::XmlRpcValue& value, std::map<std::string, JointLimits>& limits)
+{
+  for (XmlRpc::XmlRpcValue::iterator it = value.begin(); it != value.end(); ++it)
+  {
+    if (it->second.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+    {
+      ROS_ERROR_STREAM("Joint limits specification of joint '" << it->first << "' is not a struct.");
+      continue;
+    }
+    getJointLimits(it->second, limits[it->first]);
+  }
+}
+
+} // namespace
+
+/**
+ * \brief Populate a JointLimits instance from the ROS parameter server.
+ *
+ * It is assumed that the following parameter structure is followed on the provided NodeHandle. Unspecified parameters
+ * are simply not added to the joint limits specification.
+ * \code
+ * joint_limits:
+ *   foo_joint:
+ *     has_position_limits: true
+ *     min_position: 0.0
+ *     max_position: 1.0
+ *     has_velocity_limits: true
+ *     max_velocity: 2.0
+ *     has_acceleration_limits: true
+ *     max_acceleration: 5.0
+ *     has_jerk_limits: true
+ *     max_jerk: 100.0
+ *     has_effort_limits: true
+ *     max_effort: 20.0
+ *   bar_joint:
+ *     has_position_limits: false # Continuous joint
+ *     has_velocity_limits: true
+ *     max_velocity: 4.0
+ * \endcode
+ *
+ * This specification is similar to the one used by <a href="http://moveit.ros.org/wiki/MoveIt!">MoveIt!</a>,
+ * but additionally supports jerk and effort limits.
+ *
+ * \param[in] joint_name Name of joint whose limits are to be fetched.
+ * \param[in] nh NodeHandle where the joint limits are specified.
+ * \param[out] limits Where joint limit data gets written into. Limits specified in the parameter server will overwrite
+ * existing values. Values in \p limits not specified in the parameter server remain unchanged.
+ * Limits are fetched with a single parameter server query. To fetch the limits of many joints, prefer
+ * \ref getJointLimits(const ros::NodeHandle&, std::map<std::string, JointLimits>&), which fetches the limits of all
+ * joints with a single query.
+ *
+ * \return True if a limits specification is found (ie. the \p joint_limits/joint_name parameter exists in \p nh), false otherwise.
+ */
+inline bool getJointLimits(const std::string& joint_name, const ros::NodeHandle& nh, JointLimits& limits)
+{
+  XmlRpc::XmlRpcValue value;
+  try
+  {
+    const std::string limits_namespace = "joint_limits/" + joint_name;
+    if (!nh.getParam(limits_namespace, value))
+    {
+      ROS_DEBUG_STREAM("No joint limits specification found for joint '" << joint_name <<
+                       "' in the parameter server (namespace " << nh.getNamespace() + "/" + limits_namespace << ").");
+      return false;
+    }
+  }
+  catch(const ros::InvalidNameException& ex)
+  {
+    ROS_ERROR_STREAM(ex.what());
+    return false;
+  }
+
+  if (value.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+  {
+    ROS_ERROR_STREAM("Joint limits specification of joint '" << joint_name << "' is not a struct.");
+    return false;
+  }
+  internal::getJointLimits(value, limits);
+  return true;
+}
+
+/**
+ * \brief Populate JointLimits instances of all joints specified in the ROS parameter server.
+ *
+ * The whole \p joint_limits namespace of \p nh is fetched with a single parameter server query, which is much faster
+ * than calling \ref getJointLimits(const std::string&, const ros::NodeHandle&, JointLimits&) for each joint.
+ * The expected parameter structure is the same.
+ *
+ * \param[in] nh NodeHandle where the joint limits are specified.
+ * \param[out] limits Map from joint name to joint limits. Entries are added for joints without one. Limits specified in
+ * the parameter server will overwrite existing values. Values not specified in the parameter server remain unchanged.
+ * \return True if the \p joint_limits namespace exists in \p nh, false otherwise.
+ */
+inline bool getJointLimits(const ros::NodeHandle& nh, std::map<std::string, JointLimits>& limits)
+{
+  XmlRpc::XmlRpcValue value;
+  if (!nh.getParam("joint_limits", value) || value.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+  {
+    ROS_DEBUG_STREAM("No joint limits specification found in the parameter server (namespace " <<
+                     nh.getNamespace() + "/joint_limits).");
+    return false;
+  }
 
+  internal::getJointLimits(value, limits);
   return true;
 }
 
@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <joint_limits_interface/joint_limits_batch.h>
+
+using namespace hardware_interface;
+using namespace joint_limits_interface;
+
+namespace
+{
+
+// Batches produce the same results as handles, unless multiply-adds are fused, see PositionJointSaturationBatch
+#ifdef __FP_FAST_FMA
+const double EPS = 1e-12;
+#else
+const double EPS = 0.0;
+#endif
+
+double randomValue(double min, double max)
+{
+  return min + (max - min) * (static_cast<double>(std::rand()) / RAND_MAX);
+}
+
+/** \brief Joints whose limits are enforced both by handles and by a batch, with independent data. */
+class JointLimitsBatchTest : public ::testing::Test
+{
+public:
+  JointLimitsBatchTest()
+    : dim(16),
+      period(0.01),
+      pos(dim), vel(dim), eff(dim, 0.0), cmd(dim), ref_cmd(dim),
+      limits(dim)
+  {
+    std::srand(0);
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+      std::ostringstream name;
+      name << "joint_" << i;
+      ref_handles.push_back(JointHandle(JointStateHandle(name.str(), &pos[i], &vel[i], &eff[i]), &ref_cmd[i]));
+      handles.push_back(JointHandle(JointStateHandle(name.str(), &pos[i], &vel[i], &eff[i]), &cmd[i]));
+
+      // Cycle through all combinations of optional limits
+      JointLimits& l = limits[i];
+      l.has_position_limits     = i & 1;
+      l.has_velocity_limits     = true;
+      l.has_acceleration_limits = i & 2;
+      l.has_effort_limits       = true;
+      l.min_position     = randomValue(-2.0, -0.5);
+      l.max_position     = randomValue( 0.5,  2.0);
+      l.max_velocity     = randomValue( 0.5,  5.0);
+      l.max_acceleration = randomValue( 1.0, 50.0);
+      l.max_effort       = randomValue( 1.0, 20.0);
+    }
+  }
+
+protected:
+  std::size_t dim;
+  ros::Duration period;
+  std::vector<double> pos, vel, eff, cmd, ref_cmd;
+  std::vector<JointLimits> limits;
+  std::vector<JointHandle> handles, ref_handles;
+
+  /** \brief Randomize the state and set the same random command on both sets of joints. */
+  void randomize(double range)
+  {
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+      pos[i] = randomValue(-range, range);
+      vel[i] = randomValue(-range, range);
+      cmd[i] = ref_cmd[i] = randomValue(-range, range);
+    }
+  }
+};
+
+} // namespace
+
+TEST_F(JointLimitsBatchTest, PositionJointSaturation)
+{
+  PositionJointSaturationBatch batch;
+  std::vector<PositionJointSaturationHandle> ref;
+  for (std::size_t i = 0; i < dim; ++i)
+  {
+    limits[i].has_velocity_limits = i & 2; // Velocity limits are optional for this joint type
+    batch.addJoint(handles[i], limits[i]);
+    ref.push_back(PositionJointSaturationHandle(ref_handles[i], limits[i]));
+  }
+  ASSERT_EQ(dim, batch.size());
+
+  for (std::size_t k = 0; k < 100; ++k)
+  {
+    if (k == 50)
+    {
+      // Previous commands are discarded, and taken from the current position again
+      batch.reset();
+      for (std::size_t i = 0; i < dim; ++i) {ref[i].reset();}
+    }
+
+    randomize(3.0);
+    batch.enforceLimits(period);
+    for (std::size_t i = 0; i < dim; ++i) {ref[i].enforceLimits(period);}
+    for (std::size_t i = 0; i < dim; ++i) {EXPECT_NEAR(ref_cmd[i], cmd[i], EPS) << "Joint " << i << ", cycle " << k;}
+  }
+}
+
+TEST_F(JointLimitsBatchTest, VelocityJointSaturation)
+{
+  VelocityJointSaturationBatch batch;
+  std::vector<VelocityJointSaturationHandle> ref;
+  for (std::size_t i = 0; i < dim; ++i)
+  {
+    batch.addJoint(handles[i], limits[i]);
+    ref.push_back(VelocityJointSaturationHandle(ref_handles[i], limits[i]));
+  }
+  ASSERT_EQ(dim, batch.size());
+
+  for (std::size_t k = 0; k < 100; ++k)
+  {
+    randomize(6.0);
+    batch.enforceLimits(period);
+    for (std::size_t i = 0; i < dim; ++i) {ref[i].enforceLimits(period);}
+    for (std::size_t i = 0; i < dim; ++i) {EXPECT_NEAR(ref_cmd[i], cmd[i], EPS) << "Joint " << i << ", cycle " << k;}
+  }
+}
+
+TEST_F(JointLimitsBatchTest, EffortJointSaturation)
+{
+  EffortJointSaturationBatch batch;
+  std::vector<EffortJointSaturationHandle> ref;
+  for (std::size_t i = 0; i < dim; ++i)
+  {
+    batch.addJoint(handles[i], limits[i]);
+    ref.push_back(EffortJointSaturationHandle(ref_handles[i], limits[i]));
+  }
+  ASSERT_EQ(dim, batch.size());
+
+  for (std::size_t k = 0; k < 100; ++k)
+  {
+    randomize(25.0);
+    batch.enforceLimits(period);
+    for (std::size_t i = 0; i < dim; ++i) {ref[i].enforceLimits(period);}
+    for (std::size_t i = 0; i < dim; ++i) {EXPECT_NEAR(ref_cmd[i], cmd[i], EPS) << "Joint " << i << ", cycle " << k;}
+  }
+}
+
+TEST_F(JointLimitsBatchTest, PosVelJointSaturation)
+{
+  std::vector<double> cmd_vel(dim), cmd_acc(dim), ref_cmd_vel(dim), ref_cmd_acc(dim);
+
+  PosVelJointSaturationBatch batch;
+  PosVelAccJointSaturationBatch acc_batch;
+  std::vector<PosVelJointSaturationHandle> ref;
+  std::vector<PosVelAccJointSaturationHandle> acc_ref;
+  for (std::size_t i = 0; i < dim; ++i)
+  {
+    limits[i].has_velocity_limits = i & 4; // Velocity limits are optional for this joint type
+    const JointStateHandle& js = handles[i];
+    if (i % 2)
+    {
+      batch.addJoint(PosVelJointHandle(js, &cmd[i], &cmd_vel[i]), limits[i]);
+      ref.push_back(PosVelJointSaturationHandle(PosVelJointHandle(js, &ref_cmd[i], &ref_cmd_vel[i]), limits[i]));
+    }
+    else
+    {
+      acc_batch.addJoint(PosVelAccJointHandle(js, &cmd[i], &cmd_vel[i], &cmd_acc[i]), limits[i]);
+      acc_ref.push_back(PosVelAccJointSaturationHandle(
+        PosVelAccJointHandle(js, &ref_cmd[i], &ref_cmd_vel[i], &ref_cmd_acc[i]), limits[i]));
+    }
+  }
+  ASSERT_EQ(dim / 2, batch.size());
+  ASSERT_EQ(dim / 2, acc_batch.size());
+
+  for (std::size_t k = 0; k < 100; ++k)
+  {
+    if (k == 50)
+    {
+      batch.reset();
+      acc_batch.reset();
+      for (std::size_t i = 0; i < ref.size(); ++i)     {ref[i].reset();}
+      for (std::size_t i = 0; i < acc_ref.size(); ++i) {acc_ref[i].reset();}
+    }
+
+    randomize(3.0);
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+      cmd_vel[i] = ref_cmd_vel[i] = randomValue(-6.0, 6.0);
+      cmd_acc[i] = ref_cmd_acc[i] = randomValue(-60.0, 60.0);
+    }
+    batch.enforceLimits(period);
+    acc_batch.enforceLimits(period);
+    for (std::size_t i = 0; i < ref.size(); ++i)     {ref[i].enforceLimits(period);}
+    for (std::size_t i = 0; i < acc_ref.size(); ++i) {acc_ref[i].enforceLimits(period);}
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+      EXPECT_NEAR(ref_cmd[i],     cmd[i],     EPS) << "Joint " << i << ", cycle " << k;
+      EXPECT_NEAR(ref_cmd_vel[i], cmd_vel[i], EPS) << "Joint " << i << ", cycle " << k;
+      EXPECT_NEAR(ref_cmd_acc[i], cmd_acc[i], EPS) << "Joint " << i << ", cycle " << k;
+    }
+  }
+}
+
+TEST_F(JointLimitsBatchTest, InvalidJoints)
+{
+  JointLimits no_limits;
+  {
+    PositionJointSaturationBatch batch;
+    EXPECT_THROW(batch.addJoint(JointHandle(), limits[0]), JointLimitsInterfaceException);
+    EXPECT_NO_THROW(batch.addJoint(handles[0], no_limits)); // No limits are required
+    EXPECT_EQ(1, batch.size());
+  }
+  {
+    VelocityJointSaturationBatch batch;
+    EXPECT_THROW(batch.addJoint(JointHandle(), limits[0]), JointLimitsInterfaceException);
+    EXPECT_THROW(batch.addJoint(handles[0], no_limits), JointLimitsInterfaceException);
+    EXPECT_EQ(0, batch.size());
+  }
+  {
+    PosVelJointSaturationBatch batch;
+    EXPECT_THROW(batch.addJoint(PosVelJointHandle(), limits[0]), JointLimitsInterfaceException);
+    EXPECT_EQ(0, batch.size());
+  }
+  {
+    PosVelAccJointSaturationBatch batch;
+    EXPECT_THROW(batch.addJoint(PosVelAccJointHandle(), limits[0]), JointLimitsInterfaceException);
+    EXPECT_EQ(0, batch.size());
+  }
+  {
+    EffortJointSaturationBatch batch;
+    EXPECT_THROW(batch.addJoint(JointHandle(), limits[0]), JointLimitsInterfaceException);
+    EXPECT_THROW(batch.addJoint(handles[0], no_limits), JointLimitsInterfaceException);
+    EXPECT_EQ(0, batch.size());
+  }
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <joint_limits_interface/joint_limits_cache.h>
+
+using namespace joint_limits_interface;
+
+const std::string CACHE_PATH = "/tmp/joint_limits_interface_cache_test.bin";
+
+TEST(JointLimitsCacheTest, Key)
+{
+  const uint64_t key = jointLimitsCacheKey("<robot/>", "/ns", "<value><i4>1</i4></value>");
+  EXPECT_EQ(key, jointLimitsCacheKey("<robot/>", "/ns", "<value><i4>1</i4></value>"));
+  EXPECT_NE(key, jointLimitsCacheKey("<robot />", "/ns", "<value><i4>1</i4></value>"));
+  EXPECT_NE(key, jointLimitsCacheKey("<robot/>", "/other_ns", "<value><i4>1</i4></value>"));
+  EXPECT_NE(key, jointLimitsCacheKey("<robot/>", "/ns", "<value><i4>2</i4></value>"));
+  EXPECT_NE(key, jointLimitsCacheKey("<robot/>", "/ns", ""));
+  EXPECT_NE(jointLimitsCacheKey("ab", "c", ""), jointLimitsCacheKey("a", "bc", ""));
+  EXPECT_NE(jointLimitsCacheKey("a", "bc", ""), jointLimitsCacheKey("a", "b", "c"));
+}
+
+TEST(JointLimitsCacheTest, RoundTrip)
+{
+  std::vector<JointLimitsCacheEntry> entries(2);
+  entries[0].name                       = "foo_joint";
+  entries[0].limits.min_position        = -1.0;
+  entries[0].limits.max_position        =  1.0;
+  entries[0].limits.max_velocity        =  2.0;
+  entries[0].limits.max_acceleration    =  3.0;
+  entries[0].limits.max_jerk            =  4.0;
+  entries[0].limits.max_effort          =  5.0;
+  entries[0].limits.has_position_limits = true;
+  entries[0].limits.has_effort_limits   = true;
+  entries[0].has_soft_limits            = true;
+  entries[0].soft_limits.min_position   = -0.5;
+  entries[0].soft_limits.max_position   =  0.5;
+  entries[0].soft_limits.k_position     = 10.0;
+  entries[0].soft_limits.k_velocity     = 20.0;
+
+  entries[1].name                      = "bar_joint";
+  entries[1].limits.has_jerk_limits    = true;
+  entries[1].limits.angle_wraparound   = true;
+
+  const uint64_t key = jointLimitsCacheKey("<robot/>", "/ns", "");
+  ASSERT_TRUE(writeJointLimitsCache(CACHE_PATH, key, entries));
+
+  std::vector<JointLimitsCacheEntry> cached_entries;
+  ASSERT_TRUE(readJointLimitsCache(CACHE_PATH, key, cached_entries));
+  ASSERT_EQ(2, cached_entries.size());
+
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    const JointLimitsCacheEntry& expected = entries[i];
+    const JointLimitsCacheEntry& actual   = cached_entries[i];
+    EXPECT_EQ(expected.name,                           actual.name);
+    EXPECT_EQ(expected.limits.min_position,            actual.limits.min_position);
+    EXPECT_EQ(expected.limits.max_position,            actual.limits.max_position);
+    EXPECT_EQ(expected.limits.max_velocity,            actual.limits.max_velocity);
+    EXPECT_EQ(expected.limits.max_acceleration,        actual.limits.max_acceleration);
+    EXPECT_EQ(expected.limits.max_jerk,                actual.limits.max_jerk);
+    EXPECT_EQ(expected.limits.max_effort,              actual.limits.max_effort);
+    EXPECT_EQ(expected.limits.has_position_limits,     actual.limits.has_position_limits);
+    EXPECT_EQ(expected.limits.has_velocity_limits,     actual.limits.has_velocity_limits);
+    EXPECT_EQ(expected.limits.has_acceleration_limits, actual.limits.has_acceleration_limits);
+    EXPECT_EQ(expected.limits.has_jerk_limits,         actual.limits.has_jerk_limits);
+    EXPECT_EQ(expected.limits.has_effort_limits,       actual.limits.has_effort_limits);
+    EXPECT_EQ(expected.limits.angle_wraparound,        actual.limits.angle_wraparound);
+    EXPECT_EQ(expected.has_soft_limits,                actual.has_soft_limits);
+    EXPECT_EQ(expected.soft_limits.min_position,       actual.soft_limits.min_position);
+    EXPECT_EQ(expected.soft_limits.max_position,       actual.soft_limits.max_position);
+    EXPECT_EQ(expected.soft_limits.k_position,         actual.soft_limits.k_position);
+    EXPECT_EQ(expected.soft_limits.k_velocity,         actual.soft_limits.k_velocity);
+  }
+
+  // Stale cache
+  cached_entries.clear();
+  EXPECT_FALSE(readJointLimitsCache(CACHE_PATH, jointLimitsCacheKey("<robot/>", "/other_ns", ""), cached_entries));
+  EXPECT_TRUE(cached_entries.empty());
+
+  std::remove(CACHE_PATH.c_str());
+  EXPECT_FALSE(readJointLimitsCache(CACHE_PATH, key, cached_entries));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
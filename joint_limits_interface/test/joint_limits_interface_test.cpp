@@ -27,7 +27,9 @@
 
 /// \author Adolfo Rodriguez Tsouroukdissian
 
+#include <cmath>
 #include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <ros/console.h>
 #include <joint_limits_interface/joint_limits_interface.h>
@@ -115,6 +117,10 @@ TEST_F(JointLimitsHandleTest, AssertionTriggering)
 
   limits.has_acceleration_limits = true;
   EXPECT_DEATH(VelocityJointSaturationHandle(cmd_handle, limits).enforceLimits(ros::Duration(-0.1)), ".*");
+
+  limits.has_jerk_limits = true;
+  EXPECT_DEATH(PositionJointJerkSaturationHandle(cmd_handle, limits).enforceLimits(ros::Duration(-0.1)), ".*");
+  EXPECT_DEATH(VelocityJointJerkSaturationHandle(cmd_handle, limits).enforceLimits(ros::Duration(-0.1)), ".*");
 }
 #endif // NDEBUG
 
@@ -158,9 +164,32 @@ TEST_F(JointLimitsHandleTest, HandleConstruction)
     catch(const JointLimitsInterfaceException& e) {ROS_ERROR_STREAM(e.what());}
   }
 
+  {
+    JointLimits limits_bad;
+    limits_bad.has_velocity_limits = true;
+    EXPECT_THROW(PositionJointJerkSaturationHandle(cmd_handle, limits_bad), JointLimitsInterfaceException);
+    EXPECT_THROW(VelocityJointJerkSaturationHandle(cmd_handle, limits_bad), JointLimitsInterfaceException);
+
+    // Print error messages. Requires manual output inspection, but exception message should be descriptive
+    try {VelocityJointJerkSaturationHandle(cmd_handle, limits_bad);}
+    catch(const JointLimitsInterfaceException& e) {ROS_ERROR_STREAM(e.what());}
+  }
+
+  {
+    JointLimits limits_bad;
+    limits_bad.has_jerk_limits = true;
+    EXPECT_THROW(VelocityJointJerkSaturationHandle(cmd_handle, limits_bad), JointLimitsInterfaceException);
+    EXPECT_NO_THROW(PositionJointJerkSaturationHandle(cmd_handle, limits_bad)); // Only jerk limits are required
+  }
+
   EXPECT_NO_THROW(PositionJointSoftLimitsHandle(cmd_handle, limits, soft_limits));
   EXPECT_NO_THROW(EffortJointSoftLimitsHandle(cmd_handle, limits, soft_limits));
   EXPECT_NO_THROW(VelocityJointSaturationHandle(cmd_handle, limits));
+
+  limits.has_jerk_limits = true;
+  limits.max_jerk = 100.0;
+  EXPECT_NO_THROW(PositionJointJerkSaturationHandle(cmd_handle, limits));
+  EXPECT_NO_THROW(VelocityJointJerkSaturationHandle(cmd_handle, limits));
 }
 
 class PositionJointSoftLimitsHandleTest : public JointLimitsTest, public ::testing::Test {};
@@ -417,6 +446,365 @@ TEST_F(VelocityJointSaturationHandleTest, EnforceAccelerationBounds)
   EXPECT_NEAR(-limits.max_velocity, cmd_handle.getCommand(), EPS); // Max velocity bounded by velocity limit
 }
 
+class JointJerkSaturationHandleTest : public JointLimitsTest, public ::testing::Test
+{
+public:
+  JointJerkSaturationHandleTest()
+  {
+    limits.has_jerk_limits = true;
+    limits.max_jerk = 100.0;
+  }
+};
+
+TEST_F(JointJerkSaturationHandleTest, PositionEnforceBounds)
+{
+  PositionJointJerkSaturationHandle limits_handle(cmd_handle, limits);
+  const double dt = period.toSec();
+
+  // Step command from rest. Acceleration, velocity and position are bounded by the jerk limit
+  pos = 0.0;
+  cmd_handle.setCommand(limits.max_position);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_jerk * dt * dt * dt, cmd_handle.getCommand(), EPS);
+
+  // Velocity would reach 3.0 if only bounded by the jerk limit
+  const double prev_cmd = cmd_handle.getCommand();
+  cmd_handle.setCommand(limits.max_position);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(prev_cmd + limits.max_velocity * dt, cmd_handle.getCommand(), EPS);
+
+  // Position limits
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    cmd_handle.setCommand(2.0 * limits.max_position);
+    limits_handle.enforceLimits(period);
+  }
+  EXPECT_NEAR(limits.max_position, cmd_handle.getCommand(), EPS);
+}
+
+TEST_F(JointJerkSaturationHandleTest, PositionBoundedJerk)
+{
+  // Velocity and position limits are far enough not to interfere with the jerk limit
+  limits.max_position = 1000.0;
+  limits.max_velocity = 1000.0;
+  PositionJointJerkSaturationHandle limits_handle(cmd_handle, limits);
+  const double dt = period.toSec();
+
+  pos = 0.0;
+  std::vector<double> cmds(1, pos);
+  for (unsigned int i = 0; i < 20; ++i)
+  {
+    cmd_handle.setCommand(i < 10 ? 10.0 : -10.0); // Steps in both directions
+    limits_handle.enforceLimits(period);
+    cmds.push_back(cmd_handle.getCommand());
+  }
+
+  // Commanded jerk, from the third difference of the position commands. The joint starts at rest
+  cmds.insert(cmds.begin(), 2, pos);
+  for (std::size_t i = 3; i < cmds.size(); ++i)
+  {
+    const double jerk = (cmds[i] - 3.0 * cmds[i - 1] + 3.0 * cmds[i - 2] - cmds[i - 3]) / (dt * dt * dt);
+    EXPECT_LE(std::abs(jerk), limits.max_jerk * (1.0 + 1e-9)) << "Cycle " << i;
+  }
+}
+
+TEST_F(JointJerkSaturationHandleTest, PositionSustainedOverLimitCommand)
+{
+  // Lower order limits are reached long before the jerk limit stops the joint
+  limits.max_velocity = 1.0;
+  limits.has_acceleration_limits = true;
+  limits.max_acceleration = 10.0;
+  PositionJointJerkSaturationHandle limits_handle(cmd_handle, limits);
+  const ros::Duration short_period(0.001);
+  const double dt = short_period.toSec();
+
+  pos = 0.0;
+  double prev_cmd = pos;
+  for (unsigned int i = 0; i < 3000; ++i)
+  {
+    cmd_handle.setCommand(5.0);
+    limits_handle.enforceLimits(short_period);
+    const double cmd = cmd_handle.getCommand();
+    ASSERT_LE(cmd, limits.max_position) << "Cycle " << i;
+    ASSERT_GE(cmd, prev_cmd) << "Cycle " << i;
+    ASSERT_LE(cmd - prev_cmd, limits.max_velocity * dt * (1.0 + 1e-9)) << "Cycle " << i;
+    prev_cmd = cmd;
+  }
+  EXPECT_NEAR(limits.max_position, cmd_handle.getCommand(), EPS);
+
+  // Leaving the position limit starts from rest
+  cmd_handle.setCommand(limits.min_position);
+  limits_handle.enforceLimits(short_period);
+  EXPECT_NEAR(limits.max_position - limits.max_jerk * dt * dt * dt, cmd_handle.getCommand(), EPS);
+}
+
+TEST_F(JointJerkSaturationHandleTest, VelocityEnforceBounds)
+{
+  limits.max_velocity = 4.0;
+  limits.has_acceleration_limits = true;
+  limits.max_acceleration = 15.0;
+  VelocityJointJerkSaturationHandle limits_handle(cmd_handle, limits);
+  const double dt = period.toSec();
+
+  // Step command from rest. Velocity is bounded by the jerk limit
+  cmd_handle.setCommand(2.0 * limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_jerk * dt * dt, cmd_handle.getCommand(), EPS);
+
+  // Acceleration would reach 20.0 if only bounded by the jerk limit
+  double prev_cmd = cmd_handle.getCommand();
+  cmd_handle.setCommand(2.0 * limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(prev_cmd + limits.max_acceleration * dt, cmd_handle.getCommand(), EPS);
+
+  // Velocity limits
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    cmd_handle.setCommand(2.0 * limits.max_velocity);
+    limits_handle.enforceLimits(period);
+  }
+  EXPECT_NEAR(limits.max_velocity, cmd_handle.getCommand(), EPS);
+
+  // Reversing direction from constant velocity is bounded by the jerk limit again
+  prev_cmd = cmd_handle.getCommand();
+  cmd_handle.setCommand(-limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(prev_cmd - limits.max_jerk * dt * dt, cmd_handle.getCommand(), EPS);
+}
+
+TEST_F(JointJerkSaturationHandleTest, VelocitySustainedOverLimitCommand)
+{
+  limits.max_velocity = 1.0;
+  limits.has_acceleration_limits = true;
+  limits.max_acceleration = 10.0;
+  VelocityJointJerkSaturationHandle limits_handle(cmd_handle, limits);
+  const ros::Duration short_period(0.001);
+  const double dt = short_period.toSec();
+
+  // Hold a command beyond the velocity limit, in both directions
+  const double targets[] = {5.0, -5.0};
+  for (std::size_t j = 0; j < 2; ++j)
+  {
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+      cmd_handle.setCommand(targets[j]);
+      limits_handle.enforceLimits(short_period);
+      ASSERT_LE(std::abs(cmd_handle.getCommand()), limits.max_velocity) << "Cycle " << i;
+    }
+    EXPECT_NEAR(targets[j] > 0.0 ? limits.max_velocity : -limits.max_velocity, cmd_handle.getCommand(), EPS);
+  }
+
+  // Leaving the velocity limit is bounded by the jerk limit
+  cmd_handle.setCommand(0.0);
+  limits_handle.enforceLimits(short_period);
+  EXPECT_NEAR(-limits.max_velocity + limits.max_jerk * dt * dt, cmd_handle.getCommand(), EPS);
+}
+
+TEST_F(JointJerkSaturationHandleTest, ResetInterfaces)
+{
+  const double dt = period.toSec();
+  {
+    PositionJointJerkSaturationInterface iface;
+    iface.registerHandle(PositionJointJerkSaturationHandle(cmd_handle, limits));
+
+    pos = 0.0;
+    cmd_handle.setCommand(limits.max_position);
+    iface.enforceLimits(period);
+    cmd_handle.setCommand(limits.max_position);
+    iface.enforceLimits(period);
+
+    // After a reset, the joint is at rest at its current position
+    iface.reset();
+    pos = 0.5;
+    cmd_handle.setCommand(limits.max_position);
+    iface.enforceLimits(period);
+    EXPECT_NEAR(pos + limits.max_jerk * dt * dt * dt, cmd_handle.getCommand(), EPS);
+  }
+
+  {
+    VelocityJointJerkSaturationInterface iface;
+    iface.registerHandle(VelocityJointJerkSaturationHandle(cmd_handle, limits));
+
+    cmd_handle.setCommand(limits.max_velocity);
+    iface.enforceLimits(period);
+    cmd_handle.setCommand(limits.max_velocity);
+    iface.enforceLimits(period);
+
+    // After a reset, the joint is at rest
+    iface.reset();
+    cmd_handle.setCommand(limits.max_velocity);
+    iface.enforceLimits(period);
+    EXPECT_NEAR(limits.max_jerk * dt * dt, cmd_handle.getCommand(), EPS);
+  }
+}
+
+class PosVelJointLimitsHandleTest : public JointLimitsTest, public ::testing::Test
+{
+public:
+  PosVelJointLimitsHandleTest()
+    : cmd_pos(0.0), cmd_vel(0.0), cmd_acc(0.0),
+      posvel_handle(JointStateHandle(name, &pos, &vel, &eff), &cmd_pos, &cmd_vel),
+      posvelacc_handle(JointStateHandle(name, &pos, &vel, &eff), &cmd_pos, &cmd_vel, &cmd_acc)
+  {
+    limits.has_acceleration_limits = true;
+    limits.max_acceleration = 10.0;
+  }
+
+protected:
+  double cmd_pos, cmd_vel, cmd_acc;
+  PosVelJointHandle    posvel_handle;
+  PosVelAccJointHandle posvelacc_handle;
+};
+
+TEST_F(PosVelJointLimitsHandleTest, HandleConstruction)
+{
+  JointLimits limits_bad;
+  EXPECT_NO_THROW(PosVelJointSaturationHandle(posvel_handle, limits_bad)); // No limits are required
+  EXPECT_NO_THROW(PosVelAccJointSaturationHandle(posvelacc_handle, limits_bad));
+  EXPECT_THROW(PosVelJointSoftLimitsHandle(posvel_handle, limits_bad, soft_limits), JointLimitsInterfaceException);
+  EXPECT_THROW(PosVelAccJointSoftLimitsHandle(posvelacc_handle, limits_bad, soft_limits), JointLimitsInterfaceException);
+
+  EXPECT_NO_THROW(PosVelJointSoftLimitsHandle(posvel_handle, limits, soft_limits));
+  EXPECT_NO_THROW(PosVelAccJointSoftLimitsHandle(posvelacc_handle, limits, soft_limits));
+}
+
+TEST_F(PosVelJointLimitsHandleTest, SaturationEnforceBounds)
+{
+  PosVelJointSaturationHandle limits_handle(posvel_handle, limits);
+  const double dt = period.toSec();
+
+  // Commands within bounds are left unchanged
+  pos = 0.0;
+  posvel_handle.setCommand(0.1, 0.5);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(0.1, cmd_pos, EPS);
+  EXPECT_NEAR(0.5, cmd_vel, EPS);
+
+  // Position bounded by the velocity limit, velocity bounded by the acceleration limit
+  posvel_handle.setCommand(limits.max_position, 2.0 * limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(0.1 + limits.max_velocity * dt, cmd_pos, EPS);
+  EXPECT_NEAR(0.5 + limits.max_acceleration * dt, cmd_vel, EPS);
+
+  // Velocity bounded by the velocity limit
+  posvel_handle.setCommand(0.3, 2.0 * limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_velocity, cmd_vel, EPS);
+
+  // Velocity consistent with the position limits: it cannot drive the joint beyond them
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    posvel_handle.setCommand(limits.max_position, limits.max_velocity);
+    limits_handle.enforceLimits(period);
+  }
+  EXPECT_NEAR(limits.max_position, cmd_pos, EPS);
+  EXPECT_NEAR(0.0, cmd_vel, EPS);
+
+  // Moving away from the limit is allowed
+  posvel_handle.setCommand(limits.max_position, -0.5);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(-0.5, cmd_vel, EPS);
+
+  // After a reset, the joint starts from its current position and at rest
+  limits_handle.reset();
+  pos = 0.0;
+  posvel_handle.setCommand(limits.max_position, 2.0 * limits.max_velocity);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_velocity * dt, cmd_pos, EPS);
+  EXPECT_NEAR(limits.max_acceleration * dt, cmd_vel, EPS);
+}
+
+TEST_F(PosVelJointLimitsHandleTest, SaturationEnforceAccelerationBounds)
+{
+  PosVelAccJointSaturationHandle limits_handle(posvelacc_handle, limits);
+  const double dt = period.toSec();
+
+  pos = 0.0;
+  posvelacc_handle.setCommand(0.0, 0.5, 5.0);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(0.5, cmd_vel, EPS);
+  EXPECT_NEAR(5.0, cmd_acc, EPS);
+
+  // Acceleration bounded by the acceleration limit
+  posvelacc_handle.setCommand(0.0, 0.5, 2.0 * limits.max_acceleration);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_acceleration, cmd_acc, EPS);
+
+  // Acceleration consistent with the velocity limits
+  posvelacc_handle.setCommand(0.0, 1.5, limits.max_acceleration);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(1.5, cmd_vel, EPS);
+  EXPECT_NEAR((limits.max_velocity - 1.5) / dt, cmd_acc, EPS);
+
+  posvelacc_handle.setCommand(0.0, 2.0 * limits.max_velocity, limits.max_acceleration);
+  limits_handle.enforceLimits(period);
+  EXPECT_NEAR(limits.max_velocity, cmd_vel, EPS);
+  EXPECT_NEAR(0.0, cmd_acc, EPS);
+}
+
+TEST_F(PosVelJointLimitsHandleTest, SoftLimitsEnforceBounds)
+{
+  const double dt = period.toSec();
+
+  // Between soft and hard limit, only motion away from the limit is allowed
+  {
+    PosVelAccJointSoftLimitsHandle limits_handle(posvelacc_handle, limits, soft_limits);
+    pos = soft_limits.max_position + 0.02;
+    const double max_vel = -soft_limits.k_position * (pos - soft_limits.max_position);
+    ASSERT_LT(max_vel, 0.0);
+    ASSERT_GT(max_vel, -limits.max_acceleration * dt); // Reachable from rest
+
+    posvelacc_handle.setCommand(limits.max_position, limits.max_velocity, limits.max_acceleration);
+    limits_handle.enforceLimits(period);
+    EXPECT_NEAR(pos + max_vel * dt, cmd_pos, EPS);
+    EXPECT_NEAR(max_vel, cmd_vel, EPS);
+    EXPECT_NEAR(0.0, cmd_acc, EPS); // Cannot drive the joint beyond the velocity bounds
+  }
+
+  // Velocity commands are bounded by the soft velocity bounds
+  {
+    limits.has_acceleration_limits = false;
+    PosVelJointSoftLimitsHandle limits_handle(posvel_handle, limits, soft_limits);
+    pos = soft_limits.min_position - 0.02;
+    const double min_vel = -soft_limits.k_position * (pos - soft_limits.min_position);
+    ASSERT_GT(min_vel, 0.0);
+
+    posvel_handle.setCommand(limits.min_position, -limits.max_velocity);
+    limits_handle.enforceLimits(period);
+    EXPECT_NEAR(pos + min_vel * dt, cmd_pos, EPS);
+    EXPECT_NEAR(min_vel, cmd_vel, EPS);
+  }
+}
+
+TEST_F(PosVelJointLimitsHandleTest, ResetInterfaces)
+{
+  PosVelJointSaturationInterface sat_iface;
+  sat_iface.registerHandle(PosVelJointSaturationHandle(posvel_handle, limits));
+  PosVelAccJointSaturationInterface acc_sat_iface;
+  acc_sat_iface.registerHandle(PosVelAccJointSaturationHandle(posvelacc_handle, limits));
+  PosVelJointSoftLimitsInterface soft_iface;
+  soft_iface.registerHandle(PosVelJointSoftLimitsHandle(posvel_handle, limits, soft_limits));
+  PosVelAccJointSoftLimitsInterface acc_soft_iface;
+  acc_soft_iface.registerHandle(PosVelAccJointSoftLimitsHandle(posvelacc_handle, limits, soft_limits));
+
+  EXPECT_NO_THROW(sat_iface.getHandle(name));
+  EXPECT_NO_THROW(acc_soft_iface.getHandle(name));
+
+  // After a reset, the joint starts from its current position and at rest
+  pos = 0.0;
+  sat_iface.enforceLimits(period);
+  sat_iface.reset();
+  pos = 0.5;
+  posvel_handle.setCommand(0.5, limits.max_velocity);
+  sat_iface.enforceLimits(period);
+  EXPECT_NEAR(0.5, cmd_pos, EPS);
+  EXPECT_NEAR(limits.max_acceleration * period.toSec(), cmd_vel, EPS);
+
+  acc_sat_iface.reset();
+  soft_iface.reset();
+  acc_soft_iface.reset();
+}
+
 class JointLimitsInterfaceTest :public JointLimitsTest, public ::testing::Test
 {
 public:
@@ -27,8 +27,10 @@
 
 /// \author Adolfo Rodriguez Tsouroukdissian
 
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <joint_limits_interface/joint_limits_rosparam.h>
+#include <joint_limits_interface/joint_limits_cache_loader.h>
 
 using std::string;
 using namespace joint_limits_interface;
@@ -154,6 +156,119 @@ TEST(JointLimitsRosParamTest, GetJointLimits)
   }
 }
 
+TEST(JointLimitsRosParamTest, GetAllJointLimits)
+{
+  ros::NodeHandle nh("test");
+
+  // No specification
+  {
+    std::map<string, JointLimits> limits;
+    EXPECT_FALSE(getJointLimits(ros::NodeHandle("unknown_ns"), limits));
+    EXPECT_TRUE(limits.empty());
+  }
+
+  // Same results as fetching joint limits one joint at a time
+  {
+    std::map<string, JointLimits> limits;
+    limits["qux_joint"].max_velocity = 3.0; // Not in the parameter server
+    ASSERT_TRUE(getJointLimits(nh, limits));
+    EXPECT_EQ(7, limits.size());
+    EXPECT_EQ(3.0, limits["qux_joint"].max_velocity);
+
+    const char* joint_names[] = {"foo_joint", "yinfoo_joint", "yangfoo_joint", "antifoo_joint", "bar_joint", "baz_joint"};
+    for (unsigned int i = 0; i < sizeof(joint_names) / sizeof(joint_names[0]); ++i)
+    {
+      ASSERT_TRUE(limits.count(joint_names[i])) << joint_names[i];
+      const JointLimits& bulk_limits = limits[joint_names[i]];
+
+      JointLimits joint_limits;
+      EXPECT_TRUE(getJointLimits(joint_names[i], nh, joint_limits));
+      EXPECT_EQ(joint_limits.has_position_limits,     bulk_limits.has_position_limits);
+      EXPECT_EQ(joint_limits.min_position,            bulk_limits.min_position);
+      EXPECT_EQ(joint_limits.max_position,            bulk_limits.max_position);
+      EXPECT_EQ(joint_limits.has_velocity_limits,     bulk_limits.has_velocity_limits);
+      EXPECT_EQ(joint_limits.max_velocity,            bulk_limits.max_velocity);
+      EXPECT_EQ(joint_limits.has_acceleration_limits, bulk_limits.has_acceleration_limits);
+      EXPECT_EQ(joint_limits.max_acceleration,        bulk_limits.max_acceleration);
+      EXPECT_EQ(joint_limits.has_jerk_limits,         bulk_limits.has_jerk_limits);
+      EXPECT_EQ(joint_limits.max_jerk,                bulk_limits.max_jerk);
+      EXPECT_EQ(joint_limits.has_effort_limits,       bulk_limits.has_effort_limits);
+      EXPECT_EQ(joint_limits.max_effort,              bulk_limits.max_effort);
+      EXPECT_EQ(joint_limits.angle_wraparound,        bulk_limits.angle_wraparound);
+    }
+  }
+}
+
+TEST(JointLimitsRosParamTest, LoadJointLimitsThroughCache)
+{
+  const string cache_path = "/tmp/joint_limits_rosparam_test_cache.bin";
+  std::remove(cache_path.c_str());
+
+  const string robot_description =
+    "<robot name=\"robot\">"
+    "  <link name=\"base_link\"/>"
+    "  <link name=\"foo_link\"/>"
+    "  <link name=\"bar_link\"/>"
+    "  <joint name=\"foo_joint\" type=\"revolute\">"
+    "    <parent link=\"base_link\"/>"
+    "    <child link=\"foo_link\"/>"
+    "    <limit lower=\"-1.0\" upper=\"1.0\" effort=\"10.0\" velocity=\"3.0\"/>"
+    "    <safety_controller k_position=\"20.0\" k_velocity=\"0.5\" soft_lower_limit=\"-0.9\" soft_upper_limit=\"0.9\"/>"
+    "  </joint>"
+    "  <joint name=\"bar_joint\" type=\"continuous\">"
+    "    <parent link=\"foo_link\"/>"
+    "    <child link=\"bar_link\"/>"
+    "    <limit lower=\"0.0\" upper=\"0.0\" effort=\"5.0\" velocity=\"4.0\"/>"
+    "  </joint>"
+    "</robot>";
+
+  ros::NodeHandle nh("cache_test");
+  nh.setParam("joint_limits/foo_joint/has_velocity_limits", true);
+  nh.setParam("joint_limits/foo_joint/max_velocity", 2.0);
+
+  // Invalid robot description
+  {
+    std::vector<JointLimitsCacheEntry> entries;
+    EXPECT_FALSE(loadJointLimits("<robot", nh, cache_path, entries));
+    EXPECT_TRUE(entries.empty());
+  }
+
+  // Parameters overwrite the robot description, same results with and without the cache file
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    std::vector<JointLimitsCacheEntry> entries;
+    ASSERT_TRUE(loadJointLimits(robot_description, nh, cache_path, entries));
+    ASSERT_EQ(2, entries.size());
+
+    EXPECT_EQ("bar_joint", entries[0].name);
+    EXPECT_FALSE(entries[0].limits.has_position_limits);
+    EXPECT_TRUE(entries[0].limits.angle_wraparound);
+    EXPECT_EQ(4.0, entries[0].limits.max_velocity);
+    EXPECT_FALSE(entries[0].has_soft_limits);
+
+    EXPECT_EQ("foo_joint", entries[1].name);
+    EXPECT_TRUE(entries[1].limits.has_position_limits);
+    EXPECT_EQ(-1.0, entries[1].limits.min_position);
+    EXPECT_EQ(1.0, entries[1].limits.max_position);
+    EXPECT_EQ(2.0, entries[1].limits.max_velocity);
+    EXPECT_EQ(10.0, entries[1].limits.max_effort);
+    EXPECT_TRUE(entries[1].has_soft_limits);
+    EXPECT_EQ(-0.9, entries[1].soft_limits.min_position);
+    EXPECT_EQ(20.0, entries[1].soft_limits.k_position);
+  }
+
+  // Retuned parameters are not shadowed by the cache file
+  {
+    nh.setParam("joint_limits/foo_joint/max_velocity", 1.5);
+    std::vector<JointLimitsCacheEntry> entries;
+    ASSERT_TRUE(loadJointLimits(robot_description, nh, cache_path, entries));
+    ASSERT_EQ(2, entries.size());
+    EXPECT_EQ(1.5, entries[1].limits.max_velocity);
+  }
+
+  std::remove(cache_path.c_str());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
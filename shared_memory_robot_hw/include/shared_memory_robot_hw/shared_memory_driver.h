@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_DRIVER_H
+#define SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_DRIVER_H
+
+#include <string>
+#include <vector>
+
+#include <shared_memory_robot_hw/shared_memory_segment.h>
+
+namespace shared_memory_robot_hw
+{
+
+/**
+ * \brief Hardware driver side of a shared memory robot.
+ *
+ * Hardware drivers running in their own process use this class to publish joint state to, and consume joint commands
+ * from, a \ref SharedMemoryRobotHW running in the controller manager process. The driver library does not depend on
+ * ROS, so it can be linked into vendor-provided driver executables.
+ *
+ * A typical driver loop looks like this:
+ * \code
+ * shared_memory_robot_hw::SharedMemoryDriver driver("/my_robot", joint_names, shared_memory_robot_hw::POSITION_COMMAND);
+ * while (running)
+ * {
+ *   readHardware(pos, vel, eff);
+ *   driver.writeState(pos, vel, eff);
+ *   if (driver.readCommands(cmd)) {writeHardware(cmd);}
+ *   waitForNextCycle();
+ * }
+ * \endcode
+ */
+class SharedMemoryDriver
+{
+public:
+  /**
+   * \param segment_name Name of the shared memory segment to create, as accepted by \c shm_open (eg. "/my_robot").
+   * \param joint_names Names of the driven joints. They define the order of the elements of all data arrays.
+   * \param mode Meaning of the joint commands.
+   * If the segment can't be created, an exception is thrown.
+   */
+  SharedMemoryDriver(const std::string& segment_name,
+                     const std::vector<std::string>& joint_names,
+                     CommandMode mode)
+    : last_command_seq_(0)
+  {
+    segment_.create(segment_name, joint_names, mode);
+  }
+
+  /** \return Number of driven joints. */
+  std::size_t size() const {return segment_.size();}
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /** \brief Publish the joint state. Arrays must contain \ref size() elements. */
+  void writeState(const double* pos, const double* vel, const double* eff) {segment_.writeState(pos, vel, eff);}
+
+  /**
+   * \brief Copy the latest joint commands.
+   * \param[out] cmd Array of \ref size() elements.
+   * \return False if no commands have been published yet, or if a consistent copy could not be taken. \e cmd is left
+   * in an unspecified state in that case.
+   */
+  bool readCommands(double* cmd)
+  {
+    uint64_t seq = 0;
+    if (!segment_.readCommands(cmd, seq)) {return false;}
+    last_command_seq_ = seq;
+    return true;
+  }
+
+  /**
+   * \return Sequence number of the commands copied by the last successful call to \ref readCommands. It increases with
+   * every command publication, so it can be used to detect a stalled controller manager.
+   */
+  uint64_t getCommandSequence() const {return last_command_seq_;}
+  /*\}*/
+
+private:
+  SharedMemorySegment segment_;
+  uint64_t last_command_seq_;
+};
+
+}
+
+#endif // SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_DRIVER_H
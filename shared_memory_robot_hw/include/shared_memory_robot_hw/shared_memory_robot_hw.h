@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_ROBOT_HW_H
+#define SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_ROBOT_HW_H
+
+#include <string>
+#include <vector>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/joint_data_buffer.h>
+#include <hardware_interface/joint_state_interface.h>
+#include <hardware_interface/robot_hw.h>
+#include <ros/node_handle.h>
+
+#include <shared_memory_robot_hw/shared_memory_segment.h>
+
+namespace shared_memory_robot_hw
+{
+
+/**
+ * \brief Robot hardware abstraction for a hardware driver running in a separate process.
+ *
+ * Joint state and commands are exchanged with the driver process through a POSIX shared memory segment created by a
+ * \ref SharedMemoryDriver. Joint names and the command mode are taken from the segment, so no joint configuration is
+ * required on this side. This allows isolating drivers that may crash from the controller manager process.
+ *
+ * The following interfaces are registered:
+ * - \ref hardware_interface::JointStateInterface
+ * - One of \ref hardware_interface::PositionJointInterface, \ref hardware_interface::VelocityJointInterface or
+ *   \ref hardware_interface::EffortJointInterface, depending on the command mode of the driver.
+ *
+ * read() and write() exchange data without blocking on the driver process. If read() can't take a consistent snapshot
+ * of the driver state, the previous state is kept.
+ *
+ * When the driver process exits or is restarted, read() detects that the mapped segment has become stale and reopens
+ * the segment by name, at most once per second, until a driver with the same joints and command mode is back. Reopening
+ * requires system calls, so it is not realtime-safe, but it only happens while the driver is down or restarting. In the
+ * meantime, the previous state is kept and no commands are written.
+ */
+class SharedMemoryRobotHW : public hardware_interface::RobotHW
+{
+public:
+  SharedMemoryRobotHW();
+
+  /**
+   * \brief Initialize from the parameter server.
+   *
+   * The shared memory segment name is read from the \c segment_name parameter of \e robot_hw_nh.
+   */
+  virtual bool init(ros::NodeHandle& root_nh, ros::NodeHandle& robot_hw_nh);
+
+  /**
+   * \brief Initialize by opening a shared memory segment.
+   * \param segment_name Name of a segment created by a \ref SharedMemoryDriver.
+   * \return True if initialization was successful.
+   */
+  bool init(const std::string& segment_name);
+
+  virtual void read(const ros::Time& time, const ros::Duration& period);
+  virtual void write(const ros::Time& time, const ros::Duration& period);
+
+  /** \return Meaning of the joint commands, as specified by the driver. */
+  CommandMode getCommandMode() const {return command_mode_;}
+
+  /**
+   * \return Sequence number of the state copied by the last successful \ref read. It increases with every state
+   * publication of the driver, so it can be used to detect a stalled or dead driver. Zero if no state was read yet from
+   * the current driver instance.
+   */
+  uint64_t getStateSequence() const {return state_seq_;}
+
+private:
+  std::string segment_name_;
+  std::vector<std::string> joint_names_;
+  CommandMode command_mode_;
+  double next_reopen_time_; ///< Earliest time of the next attempt to reopen a stale segment, see reopen()
+
+  SharedMemorySegment segment_;
+  boost::scoped_ptr<hardware_interface::JointDataBuffer> joint_data_;
+  hardware_interface::internal::AlignedArrays scratch_; ///< State snapshot storage, see read()
+  uint64_t state_seq_;
+
+  hardware_interface::JointStateInterface    jnt_state_interface_;
+  hardware_interface::PositionJointInterface jnt_pos_interface_;
+  hardware_interface::VelocityJointInterface jnt_vel_interface_;
+  hardware_interface::EffortJointInterface   jnt_eff_interface_;
+
+  bool reopen(const ros::Time& time);
+};
+
+}
+
+#endif // SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_ROBOT_HW_H
@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_SEGMENT_H
+#define SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_SEGMENT_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/internal/aligned_arrays.h>
+
+namespace shared_memory_robot_hw
+{
+
+/** \brief Meaning of the joint commands exchanged through a shared memory segment. */
+enum CommandMode
+{
+  POSITION_COMMAND = 0,
+  VELOCITY_COMMAND,
+  EFFORT_COMMAND
+};
+
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+using hardware_interface::internal::CACHE_LINE_SIZE;
+
+const uint32_t SEGMENT_MAGIC         = 0x524f5343; // "ROSC"
+const uint32_t SEGMENT_VERSION       = 2;
+const std::size_t MAX_JOINT_NAME_SIZE = 64;        // Including the null terminator
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory synchronization requires lock-free 64-bit atomics.");
+
+/**
+ * \brief Single-writer sequence lock.
+ *
+ * The sequence counter is odd while the writer is updating the protected data. Readers take a snapshot of the data and
+ * discard it if the counter was odd or changed during the copy, so neither side ever blocks.
+ */
+struct SeqLock
+{
+  void writeBegin()
+  {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  void writeEnd()
+  {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  uint64_t readBegin() const {return seq.load(std::memory_order_acquire);}
+
+  /** \return True if the data read since \ref readBegin returned \e start is consistent. */
+  bool readEnd(uint64_t start) const
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return !(start & 1) && start == seq.load(std::memory_order_relaxed);
+  }
+
+  std::atomic<uint64_t> seq;
+};
+
+/** \brief Memory layout of the beginning of a segment. Joint names and data follow, see \ref SegmentLayout. */
+struct SegmentHeader
+{
+  std::atomic<uint32_t> magic; // Written last by the segment creator, once the segment is fully initialized
+  uint32_t version;
+  uint32_t num_joints;
+  uint32_t command_mode;
+  uint64_t size;
+  uint64_t generation;         // Number of times a segment with the same name was replaced by a new one
+  std::atomic<uint32_t> alive; // Cleared when the segment is destroyed or replaced, see SharedMemorySegment::isStale
+
+  alignas(CACHE_LINE_SIZE) SeqLock state_lock;
+  alignas(CACHE_LINE_SIZE) SeqLock command_lock;
+};
+
+/** \brief Byte offsets of the different blocks of a segment with a given number of joints. */
+struct SegmentLayout
+{
+  explicit SegmentLayout(std::size_t num_joints)
+  {
+    const std::size_t array_size = alignUp(num_joints * sizeof(double));
+    names    = alignUp(sizeof(SegmentHeader));
+    position = names + alignUp(num_joints * MAX_JOINT_NAME_SIZE);
+    velocity = position + array_size;
+    effort   = velocity + array_size;
+    command  = effort + array_size;
+    size     = command + array_size;
+  }
+
+  static std::size_t alignUp(std::size_t bytes)
+  {
+    return (bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  }
+
+  std::size_t names;
+  std::size_t position;
+  std::size_t velocity;
+  std::size_t effort;
+  std::size_t command;
+  std::size_t size;
+};
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief POSIX shared memory segment for exchanging joint state and commands between two processes.
+ *
+ * A segment is created by the hardware driver process, which determines its joints and command mode, and opened by the
+ * process running the controllers. Joint state flows from the driver to the controllers, and joint commands in the
+ * opposite direction. Each direction is protected by its own sequence lock, so both sides exchange data without
+ * blocking each other, and without system calls once the segment is mapped.
+ *
+ * Failures to create or open a segment are reported by throwing a \ref hardware_interface::HardwareInterfaceException.
+ */
+class SharedMemorySegment
+{
+public:
+  SharedMemorySegment();
+  ~SharedMemorySegment();
+
+  /**
+   * \brief Create a segment. The segment is removed from the system when this instance is destroyed.
+   * \param name Segment name, as accepted by \c shm_open (eg. "/my_robot"). A stale segment with the same name, as
+   * left behind by a crashed driver, is replaced. Processes still mapping the replaced segment can detect it with
+   * \ref isStale.
+   * \param joint_names Names of the joints whose data is exchanged through the segment.
+   * \param mode Meaning of the joint commands.
+   */
+  void create(const std::string& name, const std::vector<std::string>& joint_names, CommandMode mode);
+
+  /**
+   * \brief Open an existing segment created by another process.
+   * \param name Segment name.
+   */
+  void open(const std::string& name);
+
+  /** \brief Unmap the segment, and remove it from the system if it was created by this instance. */
+  void close() {unmap();}
+
+  /** \return True if the segment has been created or opened. */
+  bool isValid() const {return header_ != 0;}
+
+  /** \return Segment name. */
+  const std::string& getName() const {return name_;}
+
+  /** \return Number of joints whose data is exchanged through the segment. */
+  std::size_t size() const {return header_ ? header_->num_joints : 0;}
+
+  /** \return Joint names. */
+  std::vector<std::string> getJointNames() const;
+
+  /** \return Meaning of the joint commands. */
+  CommandMode getCommandMode() const {return static_cast<CommandMode>(header_->command_mode);}
+
+  /** \return Number of times the segment was replaced by a restarted driver since it was first created. */
+  uint64_t getGeneration() const {return header_->generation;}
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \return True if the segment is not valid, or if its creator has destroyed it or replaced it by a new segment with
+   * the same name. A stale segment no longer exchanges data with a driver, and must be reopened by name.
+   */
+  bool isStale() const {return !header_ || header_->alive.load(std::memory_order_acquire) == 0;}
+
+  /** \brief Publish the joint state. Must only be called from a single thread of the driver process. */
+  void writeState(const double* pos, const double* vel, const double* eff);
+
+  /**
+   * \brief Copy the latest published joint state.
+   * \param[out] seq Sequence number of the copied state, increases with every publication.
+   * \return False if no consistent state snapshot could be taken, or if no state has been published yet. Output
+   * arrays are left in an unspecified state in that case.
+   */
+  bool readState(double* pos, double* vel, double* eff, uint64_t& seq) const;
+
+  /** \brief Publish the joint commands. Must only be called from a single thread of the controllers process. */
+  void writeCommands(const double* cmd);
+
+  /** \brief Copy the latest published joint commands. \sa readState */
+  bool readCommands(double* cmd, uint64_t& seq) const;
+  /*\}*/
+
+private:
+  std::string name_;
+  bool owner_;
+  std::size_t size_;
+  void* data_;
+  internal::SegmentHeader* header_;
+  internal::SegmentLayout layout_;
+
+  void unmap();
+  double* array(std::size_t offset) const {return reinterpret_cast<double*>(static_cast<char*>(data_) + offset);}
+
+  SharedMemorySegment(const SharedMemorySegment&);
+  SharedMemorySegment& operator=(const SharedMemorySegment&);
+};
+
+}
+
+#endif // SHARED_MEMORY_ROBOT_HW_SHARED_MEMORY_SEGMENT_H
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+
+#include <pluginlib/class_list_macros.h>
+#include <ros/console.h>
+
+#include <shared_memory_robot_hw/shared_memory_robot_hw.h>
+
+namespace shared_memory_robot_hw
+{
+
+namespace
+{
+
+// Minimum time between attempts to reopen a stale segment, in seconds
+const double REOPEN_PERIOD = 1.0;
+
+} // namespace
+
+SharedMemoryRobotHW::SharedMemoryRobotHW()
+  : command_mode_(POSITION_COMMAND),
+    next_reopen_time_(0.0),
+    state_seq_(0)
+{}
+
+bool SharedMemoryRobotHW::init(ros::NodeHandle& /*root_nh*/, ros::NodeHandle& robot_hw_nh)
+{
+  std::string segment_name;
+  if (!robot_hw_nh.getParam("segment_name", segment_name))
+  {
+    ROS_ERROR_STREAM("Could not find 'segment_name' parameter (namespace: " << robot_hw_nh.getNamespace() << ").");
+    return false;
+  }
+  return init(segment_name);
+}
+
+bool SharedMemoryRobotHW::init(const std::string& segment_name)
+{
+  try
+  {
+    segment_.open(segment_name);
+  }
+  catch (const hardware_interface::HardwareInterfaceException& ex)
+  {
+    ROS_ERROR_STREAM("Failed to initialize shared memory robot: " << ex.what());
+    return false;
+  }
+
+  segment_name_ = segment_name;
+  joint_names_ = segment_.getJointNames();
+  command_mode_ = segment_.getCommandMode();
+  joint_data_.reset(new hardware_interface::JointDataBuffer(joint_names_));
+  scratch_ = hardware_interface::internal::AlignedArrays(3, joint_names_.size());
+  next_reopen_time_ = 0.0;
+  state_seq_ = 0;
+
+  joint_data_->registerHandles(jnt_state_interface_);
+  registerInterface(&jnt_state_interface_);
+
+  switch (command_mode_)
+  {
+    case POSITION_COMMAND:
+      // Position commands are initialized to the first state read from the driver
+      joint_data_->registerHandles(jnt_pos_interface_);
+      registerInterface(&jnt_pos_interface_);
+      break;
+    case VELOCITY_COMMAND:
+      std::fill(joint_data_->getCommands(), joint_data_->getCommands() + joint_data_->size(), 0.0);
+      joint_data_->registerHandles(jnt_vel_interface_);
+      registerInterface(&jnt_vel_interface_);
+      break;
+    case EFFORT_COMMAND:
+      std::fill(joint_data_->getCommands(), joint_data_->getCommands() + joint_data_->size(), 0.0);
+      joint_data_->registerHandles(jnt_eff_interface_);
+      registerInterface(&jnt_eff_interface_);
+      break;
+    default:
+      ROS_ERROR_STREAM("Failed to initialize shared memory robot: Segment '" << segment_name <<
+                       "' has an unsupported command mode.");
+      return false;
+  }
+
+  ROS_DEBUG_STREAM("Opened shared memory segment '" << segment_name << "' with " << joint_names_.size() << " joints.");
+  return true;
+}
+
+void SharedMemoryRobotHW::read(const ros::Time& time, const ros::Duration& /*period*/)
+{
+  if (!joint_data_) {return;}
+  if (segment_.isStale() && !reopen(time)) {return;}
+
+  // Read into scratch storage, so that a failed read does not clobber the previous state
+  double* pos = scratch_.data(0);
+  double* vel = scratch_.data(1);
+  double* eff = scratch_.data(2);
+  uint64_t seq = 0;
+  if (!segment_.readState(pos, vel, eff, seq)) {return;}
+
+  const std::size_t n = joint_data_->size();
+  std::copy(pos, pos + n, joint_data_->getPositions());
+  std::copy(vel, vel + n, joint_data_->getVelocities());
+  std::copy(eff, eff + n, joint_data_->getEfforts());
+
+  if (state_seq_ == 0 && command_mode_ == POSITION_COMMAND)
+  {
+    std::copy(pos, pos + n, joint_data_->getCommands());
+  }
+  state_seq_ = seq;
+}
+
+void SharedMemoryRobotHW::write(const ros::Time& /*time*/, const ros::Duration& /*period*/)
+{
+  // Commands are meaningless until the first state has been read, see read()
+  if (!joint_data_ || state_seq_ == 0) {return;}
+  segment_.writeCommands(joint_data_->getCommands());
+}
+
+bool SharedMemoryRobotHW::reopen(const ros::Time& time)
+{
+  // Commands are meaningless until the first state of the new driver instance has been read, see write()
+  state_seq_ = 0;
+  if (segment_.isValid())
+  {
+    ROS_WARN_STREAM("Shared memory segment '" << segment_name_ << "' was closed or replaced by its driver. "
+                    "Waiting for the driver to come back.");
+    segment_.close();
+  }
+
+  if (time.toSec() < next_reopen_time_) {return false;}
+  next_reopen_time_ = time.toSec() + REOPEN_PERIOD;
+
+  try
+  {
+    segment_.open(segment_name_);
+  }
+  catch (const hardware_interface::HardwareInterfaceException& ex)
+  {
+    ROS_DEBUG_STREAM("Could not reopen shared memory segment: " << ex.what());
+    return false;
+  }
+
+  if (segment_.getJointNames() != joint_names_ || segment_.getCommandMode() != command_mode_)
+  {
+    ROS_ERROR_STREAM("Shared memory segment '" << segment_name_ << "' was recreated with different joints or command "
+                     "mode. It won't be used until its driver is restarted with the original configuration.");
+    segment_.close();
+    return false;
+  }
+
+  ROS_INFO_STREAM("Reopened shared memory segment '" << segment_name_ << "' (generation " <<
+                  segment_.getGeneration() << ").");
+  return !segment_.isStale();
+}
+
+}
+
+PLUGINLIB_EXPORT_CLASS(shared_memory_robot_hw::SharedMemoryRobotHW, hardware_interface::RobotHW)
@@ -0,0 +1,314 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <hardware_interface/hardware_interface.h>
+#include <shared_memory_robot_hw/shared_memory_segment.h>
+
+namespace shared_memory_robot_hw
+{
+
+namespace
+{
+
+// Maximum number of attempts at taking a consistent data snapshot. The writer holds the lock only for the duration of
+// a few array copies, so a reader failing this many times in a row indicates a writer that died mid-update.
+const unsigned int MAX_READ_ATTEMPTS = 16;
+
+hardware_interface::HardwareInterfaceException segmentError(const std::string& name, const std::string& what)
+{
+  return hardware_interface::HardwareInterfaceException("Shared memory segment '" + name + "': " + what);
+}
+
+hardware_interface::HardwareInterfaceException systemError(const std::string& name, const std::string& what)
+{
+  return segmentError(name, what + " (" + std::strerror(errno) + ").");
+}
+
+void* mapSegment(int fd, std::size_t size)
+{
+  void* data = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  return data == MAP_FAILED ? 0 : data;
+}
+
+/**
+ * \brief Map the header of an existing segment, if it was created by a driver with the current layout version.
+ * \return Mapped header, to be released with munmap(header, sizeof(SegmentHeader)). Null if there is no such segment.
+ */
+internal::SegmentHeader* mapExistingHeader(const std::string& name)
+{
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {return 0;}
+
+  struct stat info;
+  void* data = 0;
+  if (fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(internal::SegmentHeader))
+  {
+    data = mapSegment(fd, sizeof(internal::SegmentHeader));
+  }
+  ::close(fd);
+  if (!data) {return 0;}
+
+  internal::SegmentHeader* header = static_cast<internal::SegmentHeader*>(data);
+  if (header->magic.load(std::memory_order_acquire) != internal::SEGMENT_MAGIC ||
+      header->version != internal::SEGMENT_VERSION)
+  {
+    munmap(data, sizeof(internal::SegmentHeader));
+    return 0;
+  }
+  return header;
+}
+
+} // namespace
+
+SharedMemorySegment::SharedMemorySegment()
+  : owner_(false),
+    size_(0),
+    data_(0),
+    header_(0),
+    layout_(0)
+{}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+  unmap();
+}
+
+void SharedMemorySegment::unmap()
+{
+  // A segment that was already replaced by a restarted driver must not unlink its replacement
+  const bool replaced = owner_ && header_->alive.exchange(0, std::memory_order_acq_rel) == 0;
+  if (data_) {munmap(data_, size_);}
+  if (owner_ && !replaced) {shm_unlink(name_.c_str());}
+  owner_  = false;
+  size_   = 0;
+  data_   = 0;
+  header_ = 0;
+}
+
+void SharedMemorySegment::create(const std::string& name,
+                                 const std::vector<std::string>& joint_names,
+                                 CommandMode mode)
+{
+  unmap();
+
+  for (std::vector<std::string>::const_iterator it = joint_names.begin(); it != joint_names.end(); ++it)
+  {
+    if (it->size() >= internal::MAX_JOINT_NAME_SIZE)
+    {
+      throw segmentError(name, "Joint name '" + *it + "' is too long.");
+    }
+  }
+
+  // Replace stale segments left behind by previous driver instances. The stale segment is kept mapped until the new one
+  // is fully initialized, so that processes that detect it as stale can immediately reopen the new one
+  internal::SegmentHeader* stale_header = mapExistingHeader(name);
+  try
+  {
+    shm_unlink(name.c_str());
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {throw systemError(name, "Could not create segment");}
+
+    const internal::SegmentLayout layout(joint_names.size());
+    if (ftruncate(fd, layout.size) != 0)
+    {
+      const hardware_interface::HardwareInterfaceException ex = systemError(name, "Could not set segment size");
+      ::close(fd);
+      shm_unlink(name.c_str());
+      throw ex;
+    }
+
+    void* data = mapSegment(fd, layout.size);
+    ::close(fd);
+    if (!data)
+    {
+      const hardware_interface::HardwareInterfaceException ex = systemError(name, "Could not map segment");
+      shm_unlink(name.c_str());
+      throw ex;
+    }
+
+    name_   = name;
+    owner_  = true;
+    size_   = layout.size;
+    data_   = data;
+    layout_ = layout;
+  }
+  catch (...)
+  {
+    if (stale_header) {munmap(stale_header, sizeof(internal::SegmentHeader));}
+    throw;
+  }
+
+  // Newly created segments are zero-filled, so only non-zero fields need initialization
+  header_ = new (data_) internal::SegmentHeader();
+  header_->version      = internal::SEGMENT_VERSION;
+  header_->num_joints   = joint_names.size();
+  header_->command_mode = mode;
+  header_->size         = layout_.size;
+  header_->generation   = stale_header ? stale_header->generation + 1 : 0;
+  header_->alive.store(1, std::memory_order_relaxed);
+  header_->state_lock.seq.store(0, std::memory_order_relaxed);
+  header_->command_lock.seq.store(0, std::memory_order_relaxed);
+
+  char* names = static_cast<char*>(data_) + layout_.names;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    std::strncpy(names + i * internal::MAX_JOINT_NAME_SIZE, joint_names[i].c_str(), internal::MAX_JOINT_NAME_SIZE);
+  }
+
+  header_->magic.store(internal::SEGMENT_MAGIC, std::memory_order_release);
+
+  if (stale_header)
+  {
+    stale_header->alive.store(0, std::memory_order_release);
+    munmap(stale_header, sizeof(internal::SegmentHeader));
+  }
+}
+
+void SharedMemorySegment::open(const std::string& name)
+{
+  unmap();
+
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {throw systemError(name, "Could not open segment");}
+
+  struct stat info;
+  if (fstat(fd, &info) != 0)
+  {
+    ::close(fd);
+    throw systemError(name, "Could not query segment size");
+  }
+  const std::size_t size = info.st_size;
+  if (size < sizeof(internal::SegmentHeader))
+  {
+    ::close(fd);
+    throw segmentError(name, "Segment is too small to be valid.");
+  }
+
+  void* data = mapSegment(fd, size);
+  ::close(fd);
+  if (!data) {throw systemError(name, "Could not map segment");}
+
+  name_   = name;
+  size_   = size;
+  data_   = data;
+
+  internal::SegmentHeader* header = static_cast<internal::SegmentHeader*>(data_);
+  if (header->magic.load(std::memory_order_acquire) != internal::SEGMENT_MAGIC)
+  {
+    unmap();
+    throw segmentError(name, "Segment is not initialized, or was not created by a shared memory driver.");
+  }
+  if (header->version != internal::SEGMENT_VERSION)
+  {
+    unmap();
+    throw segmentError(name, "Segment has an unsupported layout version.");
+  }
+
+  const internal::SegmentLayout layout(header->num_joints);
+  if (header->size != layout.size || size < layout.size)
+  {
+    unmap();
+    throw segmentError(name, "Segment size is inconsistent with its number of joints.");
+  }
+
+  header_ = header;
+  layout_ = layout;
+}
+
+std::vector<std::string> SharedMemorySegment::getJointNames() const
+{
+  std::vector<std::string> out;
+  const char* names = static_cast<const char*>(data_) + layout_.names;
+  for (std::size_t i = 0; i < size(); ++i)
+  {
+    const char* name = names + i * internal::MAX_JOINT_NAME_SIZE;
+    out.push_back(std::string(name, strnlen(name, internal::MAX_JOINT_NAME_SIZE)));
+  }
+  return out;
+}
+
+void SharedMemorySegment::writeState(const double* pos, const double* vel, const double* eff)
+{
+  const std::size_t bytes = size() * sizeof(double);
+  header_->state_lock.writeBegin();
+  std::memcpy(array(layout_.position), pos, bytes);
+  std::memcpy(array(layout_.velocity), vel, bytes);
+  std::memcpy(array(layout_.effort),   eff, bytes);
+  header_->state_lock.writeEnd();
+}
+
+bool SharedMemorySegment::readState(double* pos, double* vel, double* eff, uint64_t& seq) const
+{
+  const std::size_t bytes = size() * sizeof(double);
+  for (unsigned int i = 0; i < MAX_READ_ATTEMPTS; ++i)
+  {
+    const uint64_t start = header_->state_lock.readBegin();
+    if (start == 0) {return false;} // Nothing published yet
+    std::memcpy(pos, array(layout_.position), bytes);
+    std::memcpy(vel, array(layout_.velocity), bytes);
+    std::memcpy(eff, array(layout_.effort),   bytes);
+    if (header_->state_lock.readEnd(start))
+    {
+      seq = start / 2;
+      return true;
+    }
+  }
+  return false;
+}
+
+void SharedMemorySegment::writeCommands(const double* cmd)
+{
+  header_->command_lock.writeBegin();
+  std::memcpy(array(layout_.command), cmd, size() * sizeof(double));
+  header_->command_lock.writeEnd();
+}
+
+bool SharedMemorySegment::readCommands(double* cmd, uint64_t& seq) const
+{
+  for (unsigned int i = 0; i < MAX_READ_ATTEMPTS; ++i)
+  {
+    const uint64_t start = header_->command_lock.readBegin();
+    if (start == 0) {return false;} // Nothing published yet
+    std::memcpy(cmd, array(layout_.command), size() * sizeof(double));
+    if (header_->command_lock.readEnd(start))
+    {
+      seq = start / 2;
+      return true;
+    }
+  }
+  return false;
+}
+
+}
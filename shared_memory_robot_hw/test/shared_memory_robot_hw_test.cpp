@@ -0,0 +1,348 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <ros/console.h>
+#include <shared_memory_robot_hw/shared_memory_driver.h>
+#include <shared_memory_robot_hw/shared_memory_robot_hw.h>
+
+using std::string;
+using std::vector;
+using namespace shared_memory_robot_hw;
+using namespace hardware_interface;
+
+class SharedMemoryRobotHWTest : public ::testing::Test
+{
+public:
+  SharedMemoryRobotHWTest()
+  {
+    std::ostringstream os;
+    os << "/shared_memory_robot_hw_test_" << getpid();
+    segment_name = os.str();
+
+    names.push_back("joint_1");
+    names.push_back("joint_2");
+    names.push_back("joint_3");
+  }
+
+protected:
+  string segment_name;
+  vector<string> names;
+  ros::Time time;
+  ros::Duration period;
+};
+
+TEST_F(SharedMemoryRobotHWTest, SegmentErrors)
+{
+  SharedMemorySegment segment;
+  EXPECT_FALSE(segment.isValid());
+  EXPECT_THROW(segment.open(segment_name), HardwareInterfaceException);
+  EXPECT_FALSE(segment.isValid());
+
+  vector<string> bad_names(1, string(100, 'a'));
+  EXPECT_THROW(segment.create(segment_name, bad_names, POSITION_COMMAND), HardwareInterfaceException);
+
+  SharedMemoryRobotHW robot;
+  EXPECT_FALSE(robot.init(segment_name));
+}
+
+TEST_F(SharedMemoryRobotHWTest, SegmentLifetime)
+{
+  {
+    SharedMemoryDriver driver(segment_name, names, POSITION_COMMAND);
+    SharedMemorySegment segment;
+    EXPECT_NO_THROW(segment.open(segment_name));
+    EXPECT_TRUE(segment.isValid());
+    EXPECT_EQ(names, segment.getJointNames());
+    EXPECT_EQ(POSITION_COMMAND, segment.getCommandMode());
+    EXPECT_EQ(0, segment.getGeneration());
+    EXPECT_FALSE(segment.isStale());
+
+    // A driver restart replaces the segment, which makes existing mappings stale
+    SharedMemoryDriver restarted_driver(segment_name, names, EFFORT_COMMAND);
+    EXPECT_TRUE(segment.isStale());
+    EXPECT_NO_THROW(segment.open(segment_name));
+    EXPECT_FALSE(segment.isStale());
+    EXPECT_EQ(EFFORT_COMMAND, segment.getCommandMode());
+    EXPECT_EQ(1, segment.getGeneration());
+  }
+
+  // Segment is removed when its driver goes away
+  SharedMemorySegment segment;
+  EXPECT_THROW(segment.open(segment_name), HardwareInterfaceException);
+}
+
+TEST_F(SharedMemoryRobotHWTest, PositionCommands)
+{
+  SharedMemoryDriver driver(segment_name, names, POSITION_COMMAND);
+  SharedMemoryRobotHW robot;
+  ASSERT_TRUE(robot.init(segment_name));
+  EXPECT_EQ(POSITION_COMMAND, robot.getCommandMode());
+
+  JointStateInterface* state_iface = robot.get<JointStateInterface>();
+  PositionJointInterface* pos_iface = robot.get<PositionJointInterface>();
+  ASSERT_TRUE(state_iface);
+  ASSERT_TRUE(pos_iface);
+  EXPECT_FALSE(robot.get<VelocityJointInterface>());
+  EXPECT_FALSE(robot.get<EffortJointInterface>());
+  EXPECT_EQ(names, state_iface->getNames());
+
+  // Nothing is exchanged until the driver publishes its state
+  double cmd[3] = {0.0, 0.0, 0.0};
+  robot.read(time, period);
+  robot.write(time, period);
+  EXPECT_EQ(0, robot.getStateSequence());
+  EXPECT_FALSE(driver.readCommands(cmd));
+
+  const double pos[] = {1.0, 2.0, 3.0};
+  const double vel[] = {4.0, 5.0, 6.0};
+  const double eff[] = {7.0, 8.0, 9.0};
+  driver.writeState(pos, vel, eff);
+  robot.read(time, period);
+  EXPECT_EQ(1, robot.getStateSequence());
+
+  JointHandle h = pos_iface->getHandle(names[1]);
+  EXPECT_DOUBLE_EQ(pos[1], h.getPosition());
+  EXPECT_DOUBLE_EQ(vel[1], h.getVelocity());
+  EXPECT_DOUBLE_EQ(eff[1], h.getEffort());
+
+  // Position commands start at the current position
+  robot.write(time, period);
+  ASSERT_TRUE(driver.readCommands(cmd));
+  EXPECT_EQ(1, driver.getCommandSequence());
+  for (std::size_t i = 0; i < names.size(); ++i) {EXPECT_DOUBLE_EQ(pos[i], cmd[i]);}
+
+  h.setCommand(-1.0);
+  robot.write(time, period);
+  ASSERT_TRUE(driver.readCommands(cmd));
+  EXPECT_EQ(2, driver.getCommandSequence());
+  EXPECT_DOUBLE_EQ(-1.0, cmd[1]);
+}
+
+TEST_F(SharedMemoryRobotHWTest, EffortCommands)
+{
+  SharedMemoryDriver driver(segment_name, names, EFFORT_COMMAND);
+  SharedMemoryRobotHW robot;
+  ASSERT_TRUE(robot.init(segment_name));
+  EXPECT_FALSE(robot.get<PositionJointInterface>());
+  ASSERT_TRUE(robot.get<EffortJointInterface>());
+
+  const double zeros[] = {0.0, 0.0, 0.0};
+  driver.writeState(zeros, zeros, zeros);
+  robot.read(time, period);
+  robot.write(time, period);
+
+  // Effort commands start at zero
+  double cmd[3] = {1.0, 1.0, 1.0};
+  ASSERT_TRUE(driver.readCommands(cmd));
+  for (std::size_t i = 0; i < names.size(); ++i) {EXPECT_DOUBLE_EQ(0.0, cmd[i]);}
+}
+
+TEST_F(SharedMemoryRobotHWTest, DriverRestart)
+{
+  SharedMemoryRobotHW robot;
+  const double state_1[] = {1.0, 2.0, 3.0};
+  const double state_2[] = {4.0, 5.0, 6.0};
+  double cmd[3] = {0.0, 0.0, 0.0};
+  {
+    SharedMemoryDriver driver(segment_name, names, VELOCITY_COMMAND);
+    ASSERT_TRUE(robot.init(segment_name));
+    driver.writeState(state_1, state_1, state_1);
+    robot.read(ros::Time(0.0), period);
+    EXPECT_EQ(1, robot.getStateSequence());
+
+    // A driver restarting without cleaning up, as after a crash, replaces the segment. The robot detects the stale
+    // segment and reopens the new one
+    SharedMemoryDriver restarted_driver(segment_name, names, VELOCITY_COMMAND);
+    restarted_driver.writeState(state_2, state_2, state_2);
+    robot.read(ros::Time(0.0), period);
+    EXPECT_EQ(1, robot.getStateSequence());
+
+    JointHandle h = robot.get<VelocityJointInterface>()->getHandle(names[1]);
+    EXPECT_DOUBLE_EQ(state_2[1], h.getPosition());
+    h.setCommand(-1.0);
+    robot.write(ros::Time(0.0), period);
+    ASSERT_TRUE(restarted_driver.readCommands(cmd));
+    EXPECT_DOUBLE_EQ(-1.0, cmd[1]);
+  }
+
+  // Drivers exited: The previous state is kept, and no commands are written
+  robot.read(ros::Time(1.0), period);
+  robot.write(ros::Time(1.0), period);
+  EXPECT_EQ(0, robot.getStateSequence());
+  JointHandle h = robot.get<VelocityJointInterface>()->getHandle(names[1]);
+  EXPECT_DOUBLE_EQ(state_2[1], h.getPosition());
+
+  // A driver with a different configuration is not accepted
+  {
+    SharedMemoryDriver driver(segment_name, names, EFFORT_COMMAND);
+    driver.writeState(state_1, state_1, state_1);
+    robot.read(ros::Time(2.0), period);
+    EXPECT_EQ(0, robot.getStateSequence());
+    EXPECT_DOUBLE_EQ(state_2[1], h.getPosition());
+  }
+
+  // Reopening is attempted at most once per period
+  SharedMemoryDriver driver(segment_name, names, VELOCITY_COMMAND);
+  driver.writeState(state_1, state_1, state_1);
+  robot.read(ros::Time(2.5), period);
+  EXPECT_EQ(0, robot.getStateSequence());
+  robot.read(ros::Time(3.0), period);
+  EXPECT_EQ(1, robot.getStateSequence());
+  EXPECT_DOUBLE_EQ(state_1[1], h.getPosition());
+  robot.write(ros::Time(3.0), period);
+  ASSERT_TRUE(driver.readCommands(cmd));
+  EXPECT_DOUBLE_EQ(-1.0, cmd[1]);
+}
+
+void publishState(SharedMemoryDriver* driver, unsigned int iterations)
+{
+  vector<double> data(driver->size());
+  for (unsigned int i = 1; i <= iterations; ++i)
+  {
+    std::fill(data.begin(), data.end(), static_cast<double>(i));
+    driver->writeState(&data[0], &data[0], &data[0]);
+  }
+}
+
+TEST_F(SharedMemoryRobotHWTest, ConsistentSnapshots)
+{
+  vector<string> many_names;
+  for (unsigned int i = 0; i < 256; ++i)
+  {
+    std::ostringstream os;
+    os << "joint_" << i;
+    many_names.push_back(os.str());
+  }
+  SharedMemoryDriver driver(segment_name, many_names, VELOCITY_COMMAND);
+  SharedMemorySegment segment;
+  segment.open(segment_name);
+
+  // All values of a snapshot must come from the same publication
+  const unsigned int iterations = 100000;
+  std::thread writer(&publishState, &driver, iterations);
+  vector<double> pos(many_names.size()), vel(many_names.size()), eff(many_names.size());
+  uint64_t seq = 0;
+  uint64_t last_seq = 0;
+  while (last_seq < iterations)
+  {
+    if (!segment.readState(&pos[0], &vel[0], &eff[0], seq)) {continue;}
+    EXPECT_GE(seq, last_seq);
+    last_seq = seq;
+    for (std::size_t i = 0; i < many_names.size(); ++i)
+    {
+      ASSERT_EQ(static_cast<double>(seq), pos[i]);
+      ASSERT_EQ(static_cast<double>(seq), vel[i]);
+      ASSERT_EQ(static_cast<double>(seq), eff[i]);
+    }
+  }
+  writer.join();
+}
+
+TEST_F(SharedMemoryRobotHWTest, DriverProcess)
+{
+  int ready_pipe[2];
+  ASSERT_EQ(0, pipe(ready_pipe));
+
+  const pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0)
+  {
+    // Stand-in driver: Report joint efforts equal to the received commands, until commands are negative
+    close(ready_pipe[0]);
+    SharedMemoryDriver driver(segment_name, names, EFFORT_COMMAND);
+    double pos[] = {0.0, 0.0, 0.0};
+    double vel[] = {0.0, 0.0, 0.0};
+    double eff[] = {0.0, 0.0, 0.0};
+    double cmd[] = {0.0, 0.0, 0.0};
+    driver.writeState(pos, vel, eff);
+    const char ready = 1;
+    if (::write(ready_pipe[1], &ready, 1) != 1) {_exit(1);}
+    close(ready_pipe[1]);
+
+    for (unsigned int i = 0; i < 10000000; ++i)
+    {
+      if (driver.readCommands(cmd))
+      {
+        if (cmd[0] < 0.0) {_exit(0);}
+        driver.writeState(pos, vel, cmd);
+      }
+      usleep(10);
+    }
+    _exit(1);
+  }
+
+  close(ready_pipe[1]);
+  char ready = 0;
+  ASSERT_EQ(1, ::read(ready_pipe[0], &ready, 1));
+  close(ready_pipe[0]);
+
+  SharedMemoryRobotHW robot;
+  ASSERT_TRUE(robot.init(segment_name));
+  EffortJointInterface* eff_iface = robot.get<EffortJointInterface>();
+  ASSERT_TRUE(eff_iface);
+  JointHandle h = eff_iface->getHandle(names[2]);
+
+  robot.read(time, period);
+  h.setCommand(5.0);
+  robot.write(time, period);
+
+  bool echoed = false;
+  for (unsigned int i = 0; i < 100000 && !echoed; ++i)
+  {
+    robot.read(time, period);
+    echoed = h.getEffort() == 5.0;
+    usleep(10);
+  }
+  EXPECT_TRUE(echoed);
+
+  // Stop the driver
+  h.setCommand(0.0);
+  eff_iface->getHandle(names[0]).setCommand(-1.0);
+  robot.write(time, period);
+
+  int status = 0;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -34,6 +34,7 @@
 #include <string>
 #include <vector>
 
+#include <transmission_interface/fixed_transmission_data.h>
 #include <transmission_interface/transmission.h>
 #include <transmission_interface/transmission_interface_exception.h>
 
@@ -136,7 +137,7 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void actuatorToJointEffort(const ActuatorData& act_data,
-                                   JointData&    jnt_data);
+                                   JointData&    jnt_data) {actuatorToJointEffortImpl(act_data, jnt_data);}
 
   /**
    * \brief Transform \e velocity variables from actuator to joint space.
@@ -146,7 +147,7 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void actuatorToJointVelocity(const ActuatorData& act_data,
-                                     JointData&    jnt_data);
+                                     JointData&    jnt_data) {actuatorToJointVelocityImpl(act_data, jnt_data);}
 
   /**
    * \brief Transform \e position variables from actuator to joint space.
@@ -156,13 +157,13 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void actuatorToJointPosition(const ActuatorData& act_data,
-                                     JointData&    jnt_data);
+                                     JointData&    jnt_data) {actuatorToJointPositionImpl(act_data, jnt_data);}
 
   void actuatorToJointAbsolutePosition(const ActuatorData& act_data,
-                                             JointData&    jnt_data);
+                                             JointData&    jnt_data) {actuatorToJointAbsolutePositionImpl(act_data, jnt_data);}
 
   void actuatorToJointTorqueSensor(const ActuatorData& act_data,
-                                             JointData&    jnt_data);
+                                             JointData&    jnt_data) {actuatorToJointTorqueSensorImpl(act_data, jnt_data);}
 
   bool hasActuatorToJointAbsolutePosition(){
     return true;
@@ -171,6 +172,16 @@ public:
   bool hasActuatorToJointTorqueSensor(){
     return true;
   }
+
+  /**
+   * \brief Transform all state variables from actuator to joint space in a single pass.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Actuator and joint position, velocity and effort vectors must have size 2 and point to valid data.
+   *  Absolute position and torque sensor vectors are either empty, or have size 2 and point to valid data.
+   */
+  void actuatorToJointState(const ActuatorData& act_data,
+                                  JointData&    jnt_data) {actuatorToJointStateImpl(act_data, jnt_data);}
   /**
    * \brief Transform \e effort variables from joint to actuator space.
    * \param[in]  jnt_data Joint-space variables.
@@ -179,7 +190,7 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void jointToActuatorEffort(const JointData&    jnt_data,
-                                   ActuatorData& act_data);
+                                   ActuatorData& act_data) {jointToActuatorEffortImpl(jnt_data, act_data);}
 
   /**
    * \brief Transform \e velocity variables from joint to actuator space.
@@ -189,7 +200,7 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void jointToActuatorVelocity(const JointData&    jnt_data,
-                                     ActuatorData& act_data);
+                                     ActuatorData& act_data) {jointToActuatorVelocityImpl(jnt_data, act_data);}
 
   /**
    * \brief Transform \e position variables from joint to actuator space.
@@ -199,7 +210,41 @@ public:
    *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
    */
   void jointToActuatorPosition(const JointData&    jnt_data,
-                                     ActuatorData& act_data);
+                                     ActuatorData& act_data) {jointToActuatorPositionImpl(jnt_data, act_data);}
+
+  /**
+   * \name Fixed-size data overloads
+   * Same as their ActuatorData / JointData counterparts, but operating on data whose size is known at compile time.
+   * They are not part of the Transmission interface, and are meant for code that knows the concrete transmission type.
+   * In actuatorToJointState, absolute position and torque sensor data is used only if its pointers are not null.
+   *\{*/
+  void actuatorToJointEffort(const FixedActuatorData<2>& act_data,
+                                   FixedJointData<2>&    jnt_data) {actuatorToJointEffortImpl(act_data, jnt_data);}
+
+  void actuatorToJointVelocity(const FixedActuatorData<2>& act_data,
+                                     FixedJointData<2>&    jnt_data) {actuatorToJointVelocityImpl(act_data, jnt_data);}
+
+  void actuatorToJointPosition(const FixedActuatorData<2>& act_data,
+                                     FixedJointData<2>&    jnt_data) {actuatorToJointPositionImpl(act_data, jnt_data);}
+
+  void actuatorToJointAbsolutePosition(const FixedActuatorData<2>& act_data,
+                                             FixedJointData<2>&    jnt_data) {actuatorToJointAbsolutePositionImpl(act_data, jnt_data);}
+
+  void actuatorToJointTorqueSensor(const FixedActuatorData<2>& act_data,
+                                         FixedJointData<2>&    jnt_data) {actuatorToJointTorqueSensorImpl(act_data, jnt_data);}
+
+  void actuatorToJointState(const FixedActuatorData<2>& act_data,
+                                  FixedJointData<2>&    jnt_data) {actuatorToJointStateImpl(act_data, jnt_data);}
+
+  void jointToActuatorEffort(const FixedJointData<2>&    jnt_data,
+                                   FixedActuatorData<2>& act_data) {jointToActuatorEffortImpl(jnt_data, act_data);}
+
+  void jointToActuatorVelocity(const FixedJointData<2>&    jnt_data,
+                                     FixedActuatorData<2>& act_data) {jointToActuatorVelocityImpl(jnt_data, act_data);}
+
+  void jointToActuatorPosition(const FixedJointData<2>&    jnt_data,
+                                     FixedActuatorData<2>& act_data) {jointToActuatorPositionImpl(jnt_data, act_data);}
+  /*\}*/
 
   std::size_t numActuators() const {return 2;}
   std::size_t numJoints()    const {return 2;}
@@ -213,8 +258,55 @@ protected:
   std::vector<double>  jnt_reduction_;
   std::vector<double>  jnt_offset_;
   bool ignore_transmission_for_absolute_encoders_;
+
+  // Coefficients derived from the reductions on construction, so that maps multiply instead of divide
+  double inv_act_reduction_[2];      ///< \f$ 1 / n_a \f$
+  double inv_jnt_reduction_[2];      ///< \f$ 1 / n_j \f$
+  double half_inv_act_reduction_[2]; ///< \f$ 1 / (2 n_a) \f$
+  double half_inv_jnt_reduction_[2]; ///< \f$ 1 / (2 n_j) \f$
+
+private:
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointEffortImpl(const ActuatorDataType& act_data,
+                                       JointDataType&    jnt_data) const;
+
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointVelocityImpl(const ActuatorDataType& act_data,
+                                         JointDataType&    jnt_data) const;
+
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointPositionImpl(const ActuatorDataType& act_data,
+                                         JointDataType&    jnt_data) const;
+
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointAbsolutePositionImpl(const ActuatorDataType& act_data,
+                                                 JointDataType&    jnt_data) const;
+
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointTorqueSensorImpl(const ActuatorDataType& act_data,
+                                             JointDataType&    jnt_data) const;
+
+  template <class ActuatorDataType, class JointDataType>
+  void actuatorToJointStateImpl(const ActuatorDataType& act_data,
+                                      JointDataType&    jnt_data) const;
+
+  template <class JointDataType, class ActuatorDataType>
+  void jointToActuatorEffortImpl(const JointDataType&    jnt_data,
+                                       ActuatorDataType& act_data) const;
+
+  template <class JointDataType, class ActuatorDataType>
+  void jointToActuatorVelocityImpl(const JointDataType&    jnt_data,
+                                         ActuatorDataType& act_data) const;
+
+  template <class JointDataType, class ActuatorDataType>
+  void jointToActuatorPositionImpl(const JointDataType&    jnt_data,
+                                         ActuatorDataType& act_data) const;
 };
 
+/** \brief DifferentialTransmission maps have overloads for fixed-size data of two actuators and joints. */
+template <>
+struct FixedDataSize<DifferentialTransmission> : boost::integral_constant<std::size_t, 2> {};
+
 inline DifferentialTransmission::DifferentialTransmission(const bool &ignore_transmission_for_absolute_encoders,
                                                           const std::vector<double>& actuator_reduction,
                                                           const std::vector<double>& joint_reduction,
@@ -240,59 +332,71 @@ inline DifferentialTransmission::DifferentialTransmission(const bool &ignore_tra
   {
     throw TransmissionInterfaceException("Transmission reduction ratios cannot be zero.");
   }
+
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    inv_act_reduction_[i]      = 1.0 / act_reduction_[i];
+    inv_jnt_reduction_[i]      = 1.0 / jnt_reduction_[i];
+    half_inv_act_reduction_[i] = 0.5 / act_reduction_[i];
+    half_inv_jnt_reduction_[i] = 0.5 / jnt_reduction_[i];
+  }
 }
 
-inline void DifferentialTransmission::actuatorToJointEffort(const ActuatorData& act_data,
-                                                                  JointData&    jnt_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointEffortImpl(const ActuatorDataType& act_data,
+                                                                      JointDataType&    jnt_data) const
 {
   assert(numActuators() == act_data.effort.size() && numJoints() == jnt_data.effort.size());
   assert(act_data.effort[0] && act_data.effort[1] && jnt_data.effort[0] && jnt_data.effort[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const std::vector<double>& ar = act_reduction_;
+  const std::vector<double>& jr = jnt_reduction_;
 
   *jnt_data.effort[0] = jr[0] * (*act_data.effort[0] * ar[0] + *act_data.effort[1] * ar[1]);
   *jnt_data.effort[1] = jr[1] * (*act_data.effort[0] * ar[0] - *act_data.effort[1] * ar[1]);
 }
 
-inline void DifferentialTransmission::actuatorToJointVelocity(const ActuatorData& act_data,
-                                                                    JointData&    jnt_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointVelocityImpl(const ActuatorDataType& act_data,
+                                                                        JointDataType&    jnt_data) const
 {
   assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
   assert(act_data.velocity[0] && act_data.velocity[1] && jnt_data.velocity[0] && jnt_data.velocity[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const double* iar  = inv_act_reduction_;
+  const double* hijr = half_inv_jnt_reduction_;
 
-  *jnt_data.velocity[0] = (*act_data.velocity[0] / ar[0] + *act_data.velocity[1] / ar[1]) / (2.0 * jr[0]);
-  *jnt_data.velocity[1] = (*act_data.velocity[0] / ar[0] - *act_data.velocity[1] / ar[1]) / (2.0 * jr[1]);
+  *jnt_data.velocity[0] = (*act_data.velocity[0] * iar[0] + *act_data.velocity[1] * iar[1]) * hijr[0];
+  *jnt_data.velocity[1] = (*act_data.velocity[0] * iar[0] - *act_data.velocity[1] * iar[1]) * hijr[1];
 }
 
-inline void DifferentialTransmission::actuatorToJointPosition(const ActuatorData& act_data,
-                                                                    JointData&    jnt_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointPositionImpl(const ActuatorDataType& act_data,
+                                                                        JointDataType&    jnt_data) const
 {
   assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
   assert(act_data.position[0] && act_data.position[1] && jnt_data.position[0] && jnt_data.position[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const double* iar  = inv_act_reduction_;
+  const double* hijr = half_inv_jnt_reduction_;
 
-  *jnt_data.position[0] = (*act_data.position[0] / ar[0] + *act_data.position[1] / ar[1]) / (2.0 * jr[0]) + jnt_offset_[0];
-  *jnt_data.position[1] = (*act_data.position[0] / ar[0] - *act_data.position[1] / ar[1]) / (2.0 * jr[1]) + jnt_offset_[1];
+  *jnt_data.position[0] = (*act_data.position[0] * iar[0] + *act_data.position[1] * iar[1]) * hijr[0] + jnt_offset_[0];
+  *jnt_data.position[1] = (*act_data.position[0] * iar[0] - *act_data.position[1] * iar[1]) * hijr[1] + jnt_offset_[1];
 }
 
-inline void DifferentialTransmission::actuatorToJointAbsolutePosition(const ActuatorData& act_data,
-                                                                    JointData&    jnt_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointAbsolutePositionImpl(const ActuatorDataType& act_data,
+                                                                                JointDataType&    jnt_data) const
 {
   assert(numActuators() == act_data.absolute_position.size() && numJoints() == jnt_data.absolute_position.size());
-  assert(act_data.position[0] && act_data.absolute_position[1] && jnt_data.absolute_position[0] && jnt_data.absolute_position[1]);
+  assert(act_data.absolute_position[0] && act_data.absolute_position[1] && jnt_data.absolute_position[0] && jnt_data.absolute_position[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const double* iar  = inv_act_reduction_;
+  const double* hijr = half_inv_jnt_reduction_;
 
   if(!ignore_transmission_for_absolute_encoders_){
-    *jnt_data.absolute_position[0] = (*act_data.absolute_position[0] / ar[0] + *act_data.absolute_position[1] / ar[1]) / (2.0 * jr[0]) + jnt_offset_[0];
-    *jnt_data.absolute_position[1] = (*act_data.absolute_position[0] / ar[0] - *act_data.absolute_position[1] / ar[1]) / (2.0 * jr[1]) + jnt_offset_[1];
+    *jnt_data.absolute_position[0] = (*act_data.absolute_position[0] * iar[0] + *act_data.absolute_position[1] * iar[1]) * hijr[0] + jnt_offset_[0];
+    *jnt_data.absolute_position[1] = (*act_data.absolute_position[0] * iar[0] - *act_data.absolute_position[1] * iar[1]) * hijr[1] + jnt_offset_[1];
   }
   else{
     *jnt_data.absolute_position[0] = *act_data.absolute_position[1];
@@ -300,53 +404,108 @@ inline void DifferentialTransmission::actuatorToJointAbsolutePosition(const Actu
   }
 }
 
-inline void DifferentialTransmission::actuatorToJointTorqueSensor(const ActuatorData& act_data,
-                                                                    JointData&    jnt_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointTorqueSensorImpl(const ActuatorDataType& act_data,
+                                                                            JointDataType&    jnt_data) const
 {
   assert(numActuators() == act_data.torque_sensor.size() && numJoints() == jnt_data.torque_sensor.size());
   assert(act_data.torque_sensor[0] && act_data.torque_sensor[1] && jnt_data.torque_sensor[0] && jnt_data.torque_sensor[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const std::vector<double>& ar = act_reduction_;
+  const std::vector<double>& jr = jnt_reduction_;
 
   *jnt_data.torque_sensor[0] = jr[0] * (*act_data.torque_sensor[0] * ar[0] + *act_data.torque_sensor[1] * ar[1]);
   *jnt_data.torque_sensor[1] = jr[1] * (*act_data.torque_sensor[0] * ar[0] - *act_data.torque_sensor[1] * ar[1]);
 }
 
-inline void DifferentialTransmission::jointToActuatorEffort(const JointData&    jnt_data,
-                                                                  ActuatorData& act_data)
+template <class ActuatorDataType, class JointDataType>
+inline void DifferentialTransmission::actuatorToJointStateImpl(const ActuatorDataType& act_data,
+                                                                     JointDataType&    jnt_data) const
+{
+  assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
+  assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
+  assert(numActuators() == act_data.effort.size()   && numJoints() == jnt_data.effort.size());
+
+  const double ar[2]     = {act_reduction_[0], act_reduction_[1]};
+  const double jr[2]     = {jnt_reduction_[0], jnt_reduction_[1]};
+  const double iar[2]    = {inv_act_reduction_[0], inv_act_reduction_[1]};
+  const double hijr[2]   = {half_inv_jnt_reduction_[0], half_inv_jnt_reduction_[1]};
+  const double offset[2] = {jnt_offset_[0], jnt_offset_[1]};
+
+  const double pos[2] = {*act_data.position[0] * iar[0], *act_data.position[1] * iar[1]};
+  *jnt_data.position[0] = (pos[0] + pos[1]) * hijr[0] + offset[0];
+  *jnt_data.position[1] = (pos[0] - pos[1]) * hijr[1] + offset[1];
+
+  const double vel[2] = {*act_data.velocity[0] * iar[0], *act_data.velocity[1] * iar[1]};
+  *jnt_data.velocity[0] = (vel[0] + vel[1]) * hijr[0];
+  *jnt_data.velocity[1] = (vel[0] - vel[1]) * hijr[1];
+
+  const double eff[2] = {*act_data.effort[0] * ar[0], *act_data.effort[1] * ar[1]};
+  *jnt_data.effort[0] = jr[0] * (eff[0] + eff[1]);
+  *jnt_data.effort[1] = jr[1] * (eff[0] - eff[1]);
+
+  if (internal::hasData(act_data.absolute_position))
+  {
+    assert(numActuators() == act_data.absolute_position.size() && numJoints() == jnt_data.absolute_position.size());
+    const double abs_pos[2] = {*act_data.absolute_position[0], *act_data.absolute_position[1]};
+    if (!ignore_transmission_for_absolute_encoders_)
+    {
+      *jnt_data.absolute_position[0] = (abs_pos[0] * iar[0] + abs_pos[1] * iar[1]) * hijr[0] + offset[0];
+      *jnt_data.absolute_position[1] = (abs_pos[0] * iar[0] - abs_pos[1] * iar[1]) * hijr[1] + offset[1];
+    }
+    else
+    {
+      *jnt_data.absolute_position[0] = abs_pos[1];
+      *jnt_data.absolute_position[1] = abs_pos[0];
+    }
+  }
+
+  if (internal::hasData(act_data.torque_sensor))
+  {
+    assert(numActuators() == act_data.torque_sensor.size() && numJoints() == jnt_data.torque_sensor.size());
+    const double trq[2] = {*act_data.torque_sensor[0] * ar[0], *act_data.torque_sensor[1] * ar[1]};
+    *jnt_data.torque_sensor[0] = jr[0] * (trq[0] + trq[1]);
+    *jnt_data.torque_sensor[1] = jr[1] * (trq[0] - trq[1]);
+  }
+}
+
+template <class JointDataType, class ActuatorDataType>
+inline void DifferentialTransmission::jointToActuatorEffortImpl(const JointDataType&    jnt_data,
+                                                                      ActuatorDataType& act_data) const
 {
   assert(numActuators() == act_data.effort.size() && numJoints() == jnt_data.effort.size());
   assert(act_data.effort[0] && act_data.effort[1] && jnt_data.effort[0] && jnt_data.effort[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const double* hiar = half_inv_act_reduction_;
+  const double* ijr  = inv_jnt_reduction_;
 
-  *act_data.effort[0] = (*jnt_data.effort[0] / jr[0] + *jnt_data.effort[1] / jr[1]) / (2.0 * ar[0]);
-  *act_data.effort[1] = (*jnt_data.effort[0] / jr[0] - *jnt_data.effort[1] / jr[1]) / (2.0 * ar[1]);
+  *act_data.effort[0] = (*jnt_data.effort[0] * ijr[0] + *jnt_data.effort[1] * ijr[1]) * hiar[0];
+  *act_data.effort[1] = (*jnt_data.effort[0] * ijr[0] - *jnt_data.effort[1] * ijr[1]) * hiar[1];
 }
 
-inline void DifferentialTransmission::jointToActuatorVelocity(const JointData&    jnt_data,
-                                                                    ActuatorData& act_data)
+template <class JointDataType, class ActuatorDataType>
+inline void DifferentialTransmission::jointToActuatorVelocityImpl(const JointDataType&    jnt_data,
+                                                                        ActuatorDataType& act_data) const
 {
   assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
   assert(act_data.velocity[0] && act_data.velocity[1] && jnt_data.velocity[0] && jnt_data.velocity[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const std::vector<double>& ar = act_reduction_;
+  const std::vector<double>& jr = jnt_reduction_;
 
   *act_data.velocity[0] = (*jnt_data.velocity[0] * jr[0] + *jnt_data.velocity[1] * jr[1]) * ar[0];
   *act_data.velocity[1] = (*jnt_data.velocity[0] * jr[0] - *jnt_data.velocity[1] * jr[1]) * ar[1];
 }
 
-inline void DifferentialTransmission::jointToActuatorPosition(const JointData&    jnt_data,
-                                                                    ActuatorData& act_data)
+template <class JointDataType, class ActuatorDataType>
+inline void DifferentialTransmission::jointToActuatorPositionImpl(const JointDataType&    jnt_data,
+                                                                        ActuatorDataType& act_data) const
 {
   assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
   assert(act_data.position[0] && act_data.position[1] && jnt_data.position[0] && jnt_data.position[1]);
 
-  std::vector<double>& ar = act_reduction_;
-  std::vector<double>& jr = jnt_reduction_;
+  const std::vector<double>& ar = act_reduction_;
+  const std::vector<double>& jr = jnt_reduction_;
 
   double jnt_pos_off[2] = {*jnt_data.position[0] - jnt_offset_[0], *jnt_data.position[1] - jnt_offset_[1]};
 
@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_FIXED_TRANSMISSION_DATA_H
+#define TRANSMISSION_INTERFACE_FIXED_TRANSMISSION_DATA_H
+
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <transmission_interface/transmission.h>
+#include <transmission_interface/transmission_interface_exception.h>
+
+namespace transmission_interface
+{
+
+/**
+ * \brief Fixed-size counterpart of \ref ActuatorData, for transmissions with a number of actuators known at compile
+ * time.
+ *
+ * Instances do not allocate, and let transmission implementations work on data of known size. Unlike in
+ * \ref ActuatorData, where unavailable variables are represented by empty vectors, unavailable variables are
+ * represented by null pointers.
+ *
+ * \tparam N Number of actuators.
+ */
+template <std::size_t N>
+struct FixedActuatorData
+{
+  FixedActuatorData()
+  {
+    position.fill(0);
+    velocity.fill(0);
+    effort.fill(0);
+    absolute_position.fill(0);
+    torque_sensor.fill(0);
+  }
+
+  std::array<double*, N> position;
+  std::array<double*, N> velocity;
+  std::array<double*, N> effort;
+  std::array<double*, N> absolute_position;
+  std::array<double*, N> torque_sensor;
+};
+
+/**
+ * \brief Fixed-size counterpart of \ref JointData, for transmissions with a number of joints known at compile time.
+ *
+ * Unavailable variables are represented by null pointers.
+ *
+ * \tparam N Number of joints.
+ */
+template <std::size_t N>
+struct FixedJointData
+{
+  FixedJointData()
+  {
+    position.fill(0);
+    velocity.fill(0);
+    effort.fill(0);
+    absolute_position.fill(0);
+    torque_sensor.fill(0);
+  }
+
+  std::array<double*, N> position;
+  std::array<double*, N> velocity;
+  std::array<double*, N> effort;
+  std::array<double*, N> absolute_position;
+  std::array<double*, N> torque_sensor;
+};
+
+/**
+ * \brief Size of the fixed-size data accepted by the maps of a transmission type.
+ *
+ * Zero, the default, for transmissions without \ref FixedActuatorData and \ref FixedJointData overloads of their maps.
+ * Transmissions providing them specialize this template, so that code knowing their type, like
+ * \ref StaticTransmissionPipeline, can use the overloads.
+ *
+ * \tparam TransmissionType %Transmission type.
+ */
+template <class TransmissionType>
+struct FixedDataSize : boost::integral_constant<std::size_t, 0> {};
+
+namespace internal
+{
+
+/** \return True if the data pointers of a variable are available, ie. the vector is not empty. */
+inline bool hasData(const std::vector<double*>& data) {return !data.empty();}
+
+/** \return True if the data pointers of a variable are available, ie. they are not null. */
+template <std::size_t N>
+inline bool hasData(const std::array<double*, N>& data) {return 0 != data[0];}
+
+template <std::size_t N>
+inline void toFixedData(const std::vector<double*>& in,
+                        std::array<double*, N>&     out,
+                        const std::string&          name)
+{
+  if (in.empty())
+  {
+    out.fill(0);
+    return;
+  }
+  if (N != in.size())
+  {
+    std::ostringstream msg;
+    msg << "Cannot convert " << name << " data of size " << in.size() << " to fixed-size data of size " << N << ".";
+    throw TransmissionInterfaceException(msg.str());
+  }
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    if (!in[i]) {throw TransmissionInterfaceException("Cannot convert " + name + " data containing null pointers.");}
+    out[i] = in[i];
+  }
+}
+
+} // namespace
+
+/**
+ * \brief Convert dynamically-sized actuator data to its fixed-size counterpart.
+ * \param act_data Actuator data. Its vectors must be either empty or of size \e N.
+ * \return Fixed-size actuator data pointing to the same raw data as \e act_data.
+ * If \e act_data has vectors of unexpected size, or containing null pointers, an exception is thrown.
+ */
+template <std::size_t N>
+inline FixedActuatorData<N> toFixedActuatorData(const ActuatorData& act_data)
+{
+  FixedActuatorData<N> out;
+  internal::toFixedData(act_data.position,          out.position,          "actuator position");
+  internal::toFixedData(act_data.velocity,          out.velocity,          "actuator velocity");
+  internal::toFixedData(act_data.effort,            out.effort,            "actuator effort");
+  internal::toFixedData(act_data.absolute_position, out.absolute_position, "actuator absolute position");
+  internal::toFixedData(act_data.torque_sensor,     out.torque_sensor,     "actuator torque sensor");
+  return out;
+}
+
+/**
+ * \brief Convert dynamically-sized joint data to its fixed-size counterpart.
+ * \param jnt_data Joint data. Its vectors must be either empty or of size \e N.
+ * \return Fixed-size joint data pointing to the same raw data as \e jnt_data.
+ * If \e jnt_data has vectors of unexpected size, or containing null pointers, an exception is thrown.
+ */
+template <std::size_t N>
+inline FixedJointData<N> toFixedJointData(const JointData& jnt_data)
+{
+  FixedJointData<N> out;
+  internal::toFixedData(jnt_data.position,          out.position,          "joint position");
+  internal::toFixedData(jnt_data.velocity,          out.velocity,          "joint velocity");
+  internal::toFixedData(jnt_data.effort,            out.effort,            "joint effort");
+  internal::toFixedData(jnt_data.absolute_position, out.absolute_position, "joint absolute position");
+  internal::toFixedData(jnt_data.torque_sensor,     out.torque_sensor,     "joint torque sensor");
+  return out;
+}
+
+} // transmission_interface
+
+#endif // TRANSMISSION_INTERFACE_FIXED_TRANSMISSION_DATA_H
@@ -0,0 +1,479 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_LINEAR_TRANSMISSION_H
+#define TRANSMISSION_INTERFACE_LINEAR_TRANSMISSION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <transmission_interface/transmission.h>
+#include <transmission_interface/transmission_interface_exception.h>
+
+namespace transmission_interface
+{
+
+/**
+ * \brief Implementation of a generic linear transmission with an arbitrary number of actuators and joints.
+ *
+ * This transmission relates \f$ n \f$ <b>actuators</b> and \f$ m \f$ <b>joints</b> through a constant coupling matrix
+ * \f$ C \f$ of size \f$ m \times n \f$. Tendon-driven mechanisms and coupled fingers are examples of this transmission
+ * type.
+ *
+ * <CENTER>
+ * <table>
+ * <tr><th></th><th><CENTER>Effort</CENTER></th><th><CENTER>Velocity</CENTER></th><th><CENTER>Position</CENTER></th></tr>
+ * <tr><td>
+ * <b> Actuator to joint </b>
+ * </td>
+ * <td>
+ * \f[ \tau_j = (C^+)^T \tau_a \f]
+ * </td>
+ * <td>
+ * \f[ \dot{x}_j = C \dot{x}_a \f]
+ * </td>
+ * <td>
+ * \f[ x_j = C x_a + x_{off} \f]
+ * </td>
+ * </tr>
+ * <tr><td>
+ * <b> Joint to actuator </b>
+ * </td>
+ * <td>
+ * \f[ \tau_a = C^T \tau_j \f]
+ * </td>
+ * <td>
+ * \f[ \dot{x}_a = C^+ \dot{x}_j \f]
+ * </td>
+ * <td>
+ * \f[ x_a = C^+ (x_j - x_{off}) \f]
+ * </td></tr></table>
+ * </CENTER>
+ *
+ * where:
+ * - \f$ x \f$, \f$ \dot{x} \f$ and \f$ \tau \f$ are position, velocity and effort variables, respectively.
+ * - Subindices \f$ _a \f$ and \f$ _j \f$ are used to represent actuator-space and joint-space variables, respectively.
+ * - \f$ x_{off}\f$ represents the offset between motor and joint zeros, expressed in joint position coordinates.
+ * - \f$ C^+ \f$ is the Moore-Penrose pseudo-inverse of the coupling matrix. The effort maps follow from power
+ *   conservation, \f$ \tau_a^T \dot{x}_a = \tau_j^T \dot{x}_j \f$.
+ *
+ * The coupling matrix must have full rank, and at most \ref MAX_DIMENSION rows and columns. All matrices used by the
+ * maps are computed on construction, so that the maps reduce to small dense matrix-vector products. The maps keep
+ * their intermediate values on the stack, so an instance can be used by several threads concurrently, like other
+ * transmissions.
+ *
+ * Absolute position and torque sensor variables are transformed like position and effort variables, respectively.
+ *
+ * \note A SimpleTransmission with reduction \f$ n \f$ corresponds to \f$ C = [1/n] \f$, and a DifferentialTransmission
+ * with unit joint reductions to \f$ C = \frac{1}{2} \left[ \begin{array}{cc} 1/n_{a_1} & 1/n_{a_2} \\ 1/n_{a_1} &
+ * -1/n_{a_2} \end{array} \right] \f$.
+ *
+ * \ingroup transmission_types
+ */
+class LinearTransmission : public Transmission
+{
+public:
+  /** \brief Maximum number of actuators and joints of a linear transmission. */
+  static const std::size_t MAX_DIMENSION = 32;
+
+  /**
+   * \param actuator_to_joint Coupling matrix, specified as one row per joint. The \e j-th element of a row is the
+   * coupling coefficient of the \e j-th actuator.
+   * \param joint_offset Joint position offset used in the position mappings. If empty, it defaults to zero.
+   * \pre Non-empty, rectangular, full-rank coupling matrix of at most \ref MAX_DIMENSION rows and columns. Joint offset
+   * vector is empty or has one element per joint.
+   */
+  LinearTransmission(const std::vector<std::vector<double> >& actuator_to_joint,
+                     const std::vector<double>&               joint_offset = std::vector<double>());
+
+  /**
+   * \brief Transform \e effort variables from actuator to joint space.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Actuator and joint effort vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void actuatorToJointEffort(const ActuatorData& act_data,
+                                   JointData&    jnt_data);
+
+  /**
+   * \brief Transform \e velocity variables from actuator to joint space.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Actuator and joint velocity vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void actuatorToJointVelocity(const ActuatorData& act_data,
+                                     JointData&    jnt_data);
+
+  /**
+   * \brief Transform \e position variables from actuator to joint space.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Actuator and joint position vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void actuatorToJointPosition(const ActuatorData& act_data,
+                                     JointData&    jnt_data);
+
+  void actuatorToJointAbsolutePosition(const ActuatorData& act_data,
+                                             JointData&    jnt_data);
+
+  void actuatorToJointTorqueSensor(const ActuatorData& act_data,
+                                         JointData&    jnt_data);
+
+  bool hasActuatorToJointAbsolutePosition() {return true;}
+  bool hasActuatorToJointTorqueSensor()     {return true;}
+
+  /**
+   * \brief Transform \e effort variables from joint to actuator space.
+   * \param[in]  jnt_data Joint-space variables.
+   * \param[out] act_data Actuator-space variables.
+   * \pre Actuator and joint effort vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void jointToActuatorEffort(const JointData&    jnt_data,
+                                   ActuatorData& act_data);
+
+  /**
+   * \brief Transform \e velocity variables from joint to actuator space.
+   * \param[in]  jnt_data Joint-space variables.
+   * \param[out] act_data Actuator-space variables.
+   * \pre Actuator and joint velocity vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void jointToActuatorVelocity(const JointData&    jnt_data,
+                                     ActuatorData& act_data);
+
+  /**
+   * \brief Transform \e position variables from joint to actuator space.
+   * \param[in]  jnt_data Joint-space variables.
+   * \param[out] act_data Actuator-space variables.
+   * \pre Actuator and joint position vectors must have the transmission dimensions and point to valid data.
+   *  To call this method it is not required that all other data vectors contain valid data, and can even remain empty.
+   */
+  void jointToActuatorPosition(const JointData&    jnt_data,
+                                     ActuatorData& act_data);
+
+  std::size_t numActuators() const {return n_act_;}
+  std::size_t numJoints()    const {return n_jnt_;}
+
+  /** \return Coupling matrix, one row per joint. */
+  const std::vector<std::vector<double> >& getActuatorToJointMatrix() const {return act_to_jnt_;}
+
+  /** \return Pseudo-inverse of the coupling matrix, one row per actuator. */
+  std::vector<std::vector<double> > getJointToActuatorMatrix() const;
+
+  const std::vector<double>& getJointOffset() const {return jnt_offset_;}
+
+protected:
+  std::size_t n_act_;
+  std::size_t n_jnt_;
+  std::vector<std::vector<double> > act_to_jnt_;
+  std::vector<double> jnt_offset_;
+
+  // Row-major matrices used by the maps
+  std::vector<double> pos_a2j_; ///< Coupling matrix, m x n
+  std::vector<double> pos_j2a_; ///< Pseudo-inverse of the coupling matrix, n x m
+  std::vector<double> eff_a2j_; ///< Transpose of the pseudo-inverse, m x n
+  std::vector<double> eff_j2a_; ///< Transpose of the coupling matrix, n x m
+
+private:
+  /**
+   * \brief Compute <tt>out = mat * in + offset</tt>.
+   * \param mat Row-major matrix of size <tt>out.size() x in.size()</tt>.
+   * \param offset Offset added to the result, or null for no offset.
+   */
+  void multiply(const std::vector<double>&  mat,
+                const std::vector<double*>& in,
+                const std::vector<double*>& out,
+                const double*               offset = 0) const;
+
+  /// \return Pseudo-inverse of the \e rows x \e cols row-major matrix \e mat, or an empty matrix if it is rank deficient.
+  static std::vector<double> pseudoInverse(const std::vector<double>& mat, std::size_t rows, std::size_t cols);
+
+  /// \return Inverse of the \e n x \e n row-major matrix \e mat, or an empty matrix if it is singular.
+  static std::vector<double> inverse(std::vector<double> mat, std::size_t n);
+
+  static std::vector<double> transpose(const std::vector<double>& mat, std::size_t rows, std::size_t cols);
+};
+
+inline LinearTransmission::LinearTransmission(const std::vector<std::vector<double> >& actuator_to_joint,
+                                              const std::vector<double>&               joint_offset)
+  : Transmission(),
+    n_act_(actuator_to_joint.empty() ? 0 : actuator_to_joint.front().size()),
+    n_jnt_(actuator_to_joint.size()),
+    act_to_jnt_(actuator_to_joint),
+    jnt_offset_(joint_offset.empty() ? std::vector<double>(actuator_to_joint.size(), 0.0) : joint_offset)
+{
+  if (0 == n_act_ || 0 == n_jnt_)
+  {
+    throw TransmissionInterfaceException("Coupling matrix of a linear transmission cannot be empty.");
+  }
+  if (n_act_ > MAX_DIMENSION || n_jnt_ > MAX_DIMENSION)
+  {
+    std::ostringstream msg;
+    msg << "Coupling matrix of a linear transmission cannot have more than " << MAX_DIMENSION << " rows or columns.";
+    throw TransmissionInterfaceException(msg.str());
+  }
+  for (std::size_t i = 0; i < n_jnt_; ++i)
+  {
+    if (n_act_ != act_to_jnt_[i].size())
+    {
+      throw TransmissionInterfaceException("Coupling matrix of a linear transmission must have rows of equal size.");
+    }
+  }
+  if (n_jnt_ != jnt_offset_.size())
+  {
+    throw TransmissionInterfaceException("Offset vector of a linear transmission must have one element per joint.");
+  }
+
+  pos_a2j_.reserve(n_jnt_ * n_act_);
+  for (std::size_t i = 0; i < n_jnt_; ++i)
+  {
+    pos_a2j_.insert(pos_a2j_.end(), act_to_jnt_[i].begin(), act_to_jnt_[i].end());
+  }
+
+  pos_j2a_ = pseudoInverse(pos_a2j_, n_jnt_, n_act_);
+  if (pos_j2a_.empty())
+  {
+    throw TransmissionInterfaceException("Coupling matrix of a linear transmission must have full rank.");
+  }
+  eff_a2j_ = transpose(pos_j2a_, n_act_, n_jnt_);
+  eff_j2a_ = transpose(pos_a2j_, n_jnt_, n_act_);
+}
+
+inline void LinearTransmission::actuatorToJointEffort(const ActuatorData& act_data,
+                                                            JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.effort.size() && numJoints() == jnt_data.effort.size());
+  multiply(eff_a2j_, act_data.effort, jnt_data.effort);
+}
+
+inline void LinearTransmission::actuatorToJointVelocity(const ActuatorData& act_data,
+                                                              JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
+  multiply(pos_a2j_, act_data.velocity, jnt_data.velocity);
+}
+
+inline void LinearTransmission::actuatorToJointPosition(const ActuatorData& act_data,
+                                                              JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
+  multiply(pos_a2j_, act_data.position, jnt_data.position, &jnt_offset_[0]);
+}
+
+inline void LinearTransmission::actuatorToJointAbsolutePosition(const ActuatorData& act_data,
+                                                                      JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.absolute_position.size() && numJoints() == jnt_data.absolute_position.size());
+  multiply(pos_a2j_, act_data.absolute_position, jnt_data.absolute_position, &jnt_offset_[0]);
+}
+
+inline void LinearTransmission::actuatorToJointTorqueSensor(const ActuatorData& act_data,
+                                                                  JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.torque_sensor.size() && numJoints() == jnt_data.torque_sensor.size());
+  multiply(eff_a2j_, act_data.torque_sensor, jnt_data.torque_sensor);
+}
+
+inline void LinearTransmission::jointToActuatorEffort(const JointData&    jnt_data,
+                                                            ActuatorData& act_data)
+{
+  assert(numActuators() == act_data.effort.size() && numJoints() == jnt_data.effort.size());
+  multiply(eff_j2a_, jnt_data.effort, act_data.effort);
+}
+
+inline void LinearTransmission::jointToActuatorVelocity(const JointData&    jnt_data,
+                                                              ActuatorData& act_data)
+{
+  assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
+  multiply(pos_j2a_, jnt_data.velocity, act_data.velocity);
+}
+
+inline void LinearTransmission::jointToActuatorPosition(const JointData&    jnt_data,
+                                                              ActuatorData& act_data)
+{
+  assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
+
+  // Remove the offset from the gathered joint positions, then map them
+  double in[MAX_DIMENSION];
+  for (std::size_t i = 0; i < n_jnt_; ++i)
+  {
+    assert(jnt_data.position[i]);
+    in[i] = *jnt_data.position[i] - jnt_offset_[i];
+  }
+  for (std::size_t i = 0; i < n_act_; ++i)
+  {
+    assert(act_data.position[i]);
+    const double* row = &pos_j2a_[i * n_jnt_];
+    double val = 0.0;
+    for (std::size_t k = 0; k < n_jnt_; ++k) {val += row[k] * in[k];}
+    *act_data.position[i] = val;
+  }
+}
+
+inline std::vector<std::vector<double> > LinearTransmission::getJointToActuatorMatrix() const
+{
+  std::vector<std::vector<double> > out(n_act_);
+  for (std::size_t i = 0; i < n_act_; ++i)
+  {
+    out[i].assign(pos_j2a_.begin() + i * n_jnt_, pos_j2a_.begin() + (i + 1) * n_jnt_);
+  }
+  return out;
+}
+
+inline void LinearTransmission::multiply(const std::vector<double>&  mat,
+                                         const std::vector<double*>& in,
+                                         const std::vector<double*>& out,
+                                         const double*               offset) const
+{
+  // Gathering the input values first avoids dereferencing data pointers once per matrix row
+  double in_vals[MAX_DIMENSION];
+  const std::size_t cols = in.size();
+  for (std::size_t k = 0; k < cols; ++k)
+  {
+    assert(in[k]);
+    in_vals[k] = *in[k];
+  }
+
+  const double* row = &mat[0];
+  for (std::size_t i = 0; i < out.size(); ++i, row += cols)
+  {
+    assert(out[i]);
+    double val = offset ? offset[i] : 0.0;
+    for (std::size_t k = 0; k < cols; ++k) {val += row[k] * in_vals[k];}
+    *out[i] = val;
+  }
+}
+
+inline std::vector<double> LinearTransmission::pseudoInverse(const std::vector<double>& mat,
+                                                             std::size_t                rows,
+                                                             std::size_t                cols)
+{
+  // Full row rank:    A+ = A^T (A A^T)^-1
+  // Full column rank: A+ = (A^T A)^-1 A^T
+  const bool wide = rows <= cols;
+  const std::size_t n = wide ? rows : cols;
+
+  std::vector<double> gram(n * n, 0.0);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      double val = 0.0;
+      if (wide) {for (std::size_t k = 0; k < cols; ++k) {val += mat[i * cols + k] * mat[j * cols + k];}}
+      else      {for (std::size_t k = 0; k < rows; ++k) {val += mat[k * cols + i] * mat[k * cols + j];}}
+      gram[i * n + j] = val;
+    }
+  }
+
+  const std::vector<double> gram_inv = inverse(gram, n);
+  if (gram_inv.empty()) {return std::vector<double>();}
+
+  // Result has size cols x rows
+  std::vector<double> out(cols * rows, 0.0);
+  for (std::size_t i = 0; i < cols; ++i)
+  {
+    for (std::size_t j = 0; j < rows; ++j)
+    {
+      double val = 0.0;
+      if (wide) {for (std::size_t k = 0; k < n; ++k) {val += mat[k * cols + i] * gram_inv[k * n + j];}}
+      else      {for (std::size_t k = 0; k < n; ++k) {val += gram_inv[i * n + k] * mat[j * cols + k];}}
+      out[i * rows + j] = val;
+    }
+  }
+  return out;
+}
+
+inline std::vector<double> LinearTransmission::inverse(std::vector<double> mat, std::size_t n)
+{
+  // Gauss-Jordan elimination with partial pivoting
+  double scale = 0.0;
+  for (std::size_t i = 0; i < mat.size(); ++i) {scale = std::max(scale, std::abs(mat[i]));}
+  const double tolerance = scale * n * std::numeric_limits<double>::epsilon();
+
+  std::vector<double> inv(n * n, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {inv[i * n + i] = 1.0;}
+
+  for (std::size_t col = 0; col < n; ++col)
+  {
+    std::size_t pivot = col;
+    for (std::size_t row = col + 1; row < n; ++row)
+    {
+      if (std::abs(mat[row * n + col]) > std::abs(mat[pivot * n + col])) {pivot = row;}
+    }
+    if (std::abs(mat[pivot * n + col]) <= tolerance) {return std::vector<double>();}
+
+    if (pivot != col)
+    {
+      std::swap_ranges(mat.begin() + pivot * n, mat.begin() + (pivot + 1) * n, mat.begin() + col * n);
+      std::swap_ranges(inv.begin() + pivot * n, inv.begin() + (pivot + 1) * n, inv.begin() + col * n);
+    }
+
+    const double div = mat[col * n + col];
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      mat[col * n + k] /= div;
+      inv[col * n + k] /= div;
+    }
+
+    for (std::size_t row = 0; row < n; ++row)
+    {
+      const double factor = mat[row * n + col];
+      if (row == col || 0.0 == factor) {continue;}
+      for (std::size_t k = 0; k < n; ++k)
+      {
+        mat[row * n + k] -= factor * mat[col * n + k];
+        inv[row * n + k] -= factor * inv[col * n + k];
+      }
+    }
+  }
+  return inv;
+}
+
+inline std::vector<double> LinearTransmission::transpose(const std::vector<double>& mat,
+                                                         std::size_t                rows,
+                                                         std::size_t                cols)
+{
+  std::vector<double> out(mat.size());
+  for (std::size_t i = 0; i < rows; ++i)
+  {
+    for (std::size_t j = 0; j < cols; ++j) {out[j * rows + i] = mat[i * cols + j];}
+  }
+  return out;
+}
+
+} // transmission_interface
+
+#endif // TRANSMISSION_INTERFACE_LINEAR_TRANSMISSION_H
@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_LINEAR_TRANSMISSION_LOADER_H
+#define TRANSMISSION_INTERFACE_LINEAR_TRANSMISSION_LOADER_H
+
+// TinyXML
+#include <tinyxml.h>
+
+// ros_control
+#include <transmission_interface/transmission_loader.h>
+
+namespace transmission_interface
+{
+
+/**
+ * \brief Class for loading a linear transmission instance from configuration data.
+ *
+ * Each joint specifies its row of the coupling matrix in a required <tt>\<coupling\></tt> element, as a
+ * whitespace-separated list with one coefficient per actuator. Coefficients follow the order in which actuators are
+ * declared in the transmission. Joints can also specify an optional <tt>\<offset\></tt> element:
+ * \code
+ * <transmission name="wrist_trans">
+ *   <type>transmission_interface/LinearTransmission</type>
+ *   <joint name="wrist_pitch_joint">
+ *     <coupling>0.5 0.5</coupling>
+ *     <offset>0.1</offset>
+ *     <hardwareInterface>hardware_interface/PositionJointInterface</hardwareInterface>
+ *   </joint>
+ *   <joint name="wrist_roll_joint">
+ *     <coupling>0.5 -0.5</coupling>
+ *     <hardwareInterface>hardware_interface/PositionJointInterface</hardwareInterface>
+ *   </joint>
+ *   <actuator name="wrist_left_motor"/>
+ *   <actuator name="wrist_right_motor"/>
+ * </transmission>
+ * \endcode
+ */
+class LinearTransmissionLoader : public TransmissionLoader
+{
+public:
+  TransmissionPtr load(const TransmissionInfo& transmission_info);
+
+private:
+  static ParseStatus getJointCoupling(const TiXmlElement& parent_el,
+                                      const std::string&  joint_name,
+                                      const std::string&  transmission_name,
+                                      std::vector<double>& coupling);
+};
+
+} // namespace
+
+#endif // header guard
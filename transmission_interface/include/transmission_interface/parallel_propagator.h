@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_PARALLEL_PROPAGATOR_H
+#define TRANSMISSION_INTERFACE_PARALLEL_PROPAGATOR_H
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <transmission_interface/propagation_worker_pool.h>
+#include <transmission_interface/transmission_interface.h>
+
+namespace transmission_interface
+{
+
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+// Representative of the set containing element i, with path halving
+inline std::size_t findSet(std::vector<std::size_t>& parent, std::size_t i)
+{
+  while (parent[i] != i)
+  {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief Propagates the handles of a \ref TransmissionInterface in parallel, using a \ref PropagationWorkerPool.
+ *
+ * Handles are partitioned into independent groups, such that handles sharing any actuator or joint data belong to
+ * the same group and are propagated by a single thread, in the same order as in serial propagation. Groups are then
+ * packed into one chunk of consecutive handles per thread of the pool, which keeps the data of neighbouring
+ * transmissions in the same cache. Handles are propagated serially while their number is below a threshold, as waking
+ * up the workers costs more than propagating small sets of transmissions.
+ *
+ * Partitioning is repeated whenever handles are registered, so for large interfaces it is cheaper to attach the
+ * propagator once all handles are registered:
+ * \code
+ * boost::shared_ptr<PropagationWorkerPool> pool(new PropagationWorkerPool(3));
+ * act_to_jnt_pos.setPropagator(boost::make_shared<ParallelPropagator<ActuatorToJointPositionHandle> >(pool));
+ * \endcode
+ *
+ * The pool above suits non-realtime callers only. Propagation from a realtime control loop needs workers pinned to other
+ * CPUs at a realtime priority, see \ref PropagationWorkerPool.
+ *
+ * \tparam HandleType %Transmission handle type. Handles not deriving from \ref TransmissionHandle are always propagated
+ * serially, as the data they share cannot be identified.
+ */
+template <class HandleType>
+class ParallelPropagator : public HandlePropagator<HandleType>
+{
+public:
+  /** \brief Default minimum number of handles for propagating in parallel. */
+  static const std::size_t DEFAULT_PARALLEL_THRESHOLD = 256;
+
+  /**
+   * \param pool Worker pool. Can be shared with other propagators not run concurrently with this one.
+   * \param min_handles Minimum number of handles for propagating in parallel.
+   */
+  ParallelPropagator(const boost::shared_ptr<PropagationWorkerPool>& pool,
+                     std::size_t min_handles = DEFAULT_PARALLEL_THRESHOLD)
+    : pool_(pool),
+      parallel_threshold_(min_handles)
+  {}
+
+  /** \return Number of chunks of handles propagated in parallel, or zero if propagation is serial. */
+  std::size_t getNumChunks() const {return isParallel() ? chunk_ends_.size() : 0;}
+
+  void setHandles(const std::vector<HandleType>& handles)
+  {
+    handles_ = handles;
+    updateChunks();
+  }
+
+  void propagate()
+  {
+    if (isParallel())
+    {
+      pool_->run(chunk_ends_.size(), &ParallelPropagator::propagateChunk, this);
+      return;
+    }
+
+    typedef typename std::vector<HandleType>::iterator IteratorType;
+    for (IteratorType it = handles_.begin(); it != handles_.end(); ++it)
+    {
+      it->propagate();
+    }
+  }
+
+private:
+  boost::shared_ptr<PropagationWorkerPool> pool_;
+  std::size_t parallel_threshold_;
+  std::vector<HandleType> handles_;
+
+  /**
+   * Handles grouped for parallel propagation. Chunk \e i spans the range [chunk_ends_[i-1], chunk_ends_[i]), and
+   * handles of a chunk are propagated in order by the same thread.
+   */
+  std::vector<HandleType>  chunk_handles_;
+  std::vector<std::size_t> chunk_ends_;
+
+  bool isParallel() const
+  {
+    return pool_ && handles_.size() >= parallel_threshold_ && chunk_ends_.size() > 1;
+  }
+
+  static void propagateChunk(void* context, std::size_t chunk)
+  {
+    ParallelPropagator* self = static_cast<ParallelPropagator*>(context);
+    const std::size_t begin = (chunk == 0) ? 0 : self->chunk_ends_[chunk - 1];
+    const std::size_t end   = self->chunk_ends_[chunk];
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      self->chunk_handles_[i].propagate();
+    }
+  }
+
+  void updateChunks()
+  {
+    chunk_handles_.clear();
+    chunk_ends_.clear();
+    if (!pool_ || handles_.size() < parallel_threshold_) {return;}
+
+    // Group handles accessing the same data
+    const std::size_t size = handles_.size();
+    std::vector<std::size_t> parent(size);
+    for (std::size_t i = 0; i < size; ++i) {parent[i] = i;}
+
+    typedef boost::is_base_of<TransmissionHandle, HandleType> HasData;
+    std::map<const double*, std::size_t> data_owners;
+    std::vector<const double*> data;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      data.clear();
+      if (!internal::getDataPointers(handles_[i], data, HasData())) {return;} // Dependencies unknown, stay serial
+
+      for (std::size_t j = 0; j < data.size(); ++j)
+      {
+        const std::pair<std::map<const double*, std::size_t>::iterator, bool> res =
+          data_owners.insert(std::make_pair(data[j], i));
+        if (!res.second) {parent[internal::findSet(parent, i)] = internal::findSet(parent, res.first->second);}
+      }
+    }
+
+    // Lay out groups in order of their first handle, each with its handles in serial propagation order
+    std::vector<std::vector<std::size_t> > groups;
+    std::map<std::size_t, std::size_t> group_index; // Set representative -> group
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const std::size_t root = internal::findSet(parent, i);
+      const std::pair<std::map<std::size_t, std::size_t>::iterator, bool> res =
+        group_index.insert(std::make_pair(root, groups.size()));
+      if (res.second) {groups.push_back(std::vector<std::size_t>());}
+      groups[res.first->second].push_back(i);
+    }
+
+    // Pack consecutive groups into one chunk per thread
+    const std::size_t num_chunks = std::min(pool_->concurrency(), groups.size());
+    const std::size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+    chunk_handles_.reserve(size);
+    for (std::size_t g = 0; g < groups.size(); ++g)
+    {
+      for (std::size_t j = 0; j < groups[g].size(); ++j) {chunk_handles_.push_back(handles_[groups[g][j]]);}
+      if (chunk_handles_.size() >= (chunk_ends_.size() + 1) * chunk_size || g + 1 == groups.size())
+      {
+        chunk_ends_.push_back(chunk_handles_.size());
+      }
+    }
+  }
+};
+
+} // transmission_interface
+
+#endif // TRANSMISSION_INTERFACE_PARALLEL_PROPAGATOR_H
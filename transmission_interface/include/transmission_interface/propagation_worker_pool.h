@@ -0,0 +1,273 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_PROPAGATION_WORKER_POOL_H
+#define TRANSMISSION_INTERFACE_PROPAGATION_WORKER_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <boost/chrono/duration.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <ros/console.h>
+
+namespace transmission_interface
+{
+
+/**
+ * \brief Small pool of worker threads for propagating transmission maps in parallel.
+ *
+ * Work is submitted with \ref run as a number of independent tasks, which are distributed among the workers and the
+ * calling thread. Workers can be pinned to CPUs, so that the data they propagate stays in the caches of the same cores
+ * across control cycles.
+ *
+ * Work is handed over to the workers through atomic variables only, so \ref run takes no locks and, as long as the
+ * workers get CPU time when they need it, makes no system calls. Idle workers either busy-wait, which is suited for
+ * CPUs dedicated to the control loop, or poll for new work with short sleeps, which leaves their CPUs mostly free. In
+ * the latter case, tasks submitted while all workers sleep are executed by the calling thread, as tasks are claimed by
+ * whichever thread gets to them first.
+ *
+ * For use from a realtime control loop, pin the workers to CPUs other than the one of the control loop, and give them
+ * a realtime priority, see \ref PropagationWorkerPool(const std::vector<int>&, bool, int). Workers created by
+ * \ref PropagationWorkerPool(std::size_t, bool) are neither pinned nor realtime, so a realtime caller can preempt them
+ * in the middle of a task. \ref run then does not stall, but waits for them by sleeping, see \ref run.
+ *
+ * \note A pool can be shared by several transmission interfaces, as long as they are not propagated concurrently.
+ */
+class PropagationWorkerPool : boost::noncopyable
+{
+public:
+  /**
+   * \brief Function executing a single task.
+   * \param context Context passed to \ref run.
+   * \param task Task index, in the range [0, number of tasks).
+   */
+  typedef void (*TaskFunction)(void* context, std::size_t task);
+
+  /** \brief Time idle workers sleep between polls for new work, unless they busy-wait. */
+  static const unsigned int IDLE_SLEEP_US = 50;
+
+  /** \brief Iterations \ref run busy-waits for the workers before falling back, see \ref run. */
+  static const unsigned int MAX_WAIT_SPINS = 10000;
+
+  /**
+   * \param num_workers Number of worker threads, which are not pinned to any CPU and run at the default priority.
+   * \param busy_wait Whether idle workers busy-wait for new tasks instead of sleeping between polls.
+   * \note Not meant for realtime callers, see the class documentation.
+   */
+  explicit PropagationWorkerPool(std::size_t num_workers, bool busy_wait = false)
+  {
+    init(std::vector<int>(num_workers, -1), busy_wait, 0);
+  }
+
+  /**
+   * \param cpus CPU each worker thread is pinned to, or -1 to leave it unpinned. One worker is created per element.
+   * \param busy_wait Whether idle workers busy-wait for new tasks instead of sleeping between polls.
+   * \param priority \p SCHED_FIFO priority of the worker threads, usually the one of the realtime caller. Zero keeps
+   * the default scheduling policy and priority.
+   */
+  explicit PropagationWorkerPool(const std::vector<int>& cpus, bool busy_wait = false, int priority = 0)
+  {
+    init(cpus, busy_wait, priority);
+  }
+
+  ~PropagationWorkerPool()
+  {
+    stop_.store(true);
+    workers_.join_all();
+  }
+
+  /** \return Number of worker threads. */
+  std::size_t numWorkers() const {return workers_.size();}
+
+  /** \return Number of threads executing tasks in \ref run, ie. the workers and the calling thread. */
+  std::size_t concurrency() const {return workers_.size() + 1;}
+
+  /**
+   * \brief Execute tasks in parallel, and wait for their completion.
+   *
+   * The calling thread also executes tasks. This method does not allocate memory, takes no locks and makes no system
+   * calls. It must not be called concurrently from several threads.
+   *
+   * Waits for the workers are bounded by \ref MAX_WAIT_SPINS iterations. If a worker of the previous call is still
+   * active after that, the tasks are executed serially by the calling thread. If a task claimed by a worker is still
+   * running after that, the calling thread sleeps between polls, so that a preempted worker sharing its CPU can
+   * complete it.
+   * \param num_tasks Number of tasks.
+   * \param function Function executing a single task.
+   * \param context Context passed to \e function.
+   */
+  void run(std::size_t num_tasks, TaskFunction function, void* context)
+  {
+    if (num_tasks == 0) {return;}
+
+    // An odd generation tells workers that task parameters are being replaced. Workers that joined the previous run
+    // before that must be done with it before its parameters change. They only have to notice that no tasks are left,
+    // as all of them were completed before the previous call returned
+    generation_.fetch_add(1);
+    for (unsigned int spins = 0; active_workers_.load() != 0; ++spins)
+    {
+      if (spins == MAX_WAIT_SPINS)
+      {
+        // The worker is not getting CPU time. Task parameters can't change while it may read them, so restore an even
+        // generation with the parameters of the previous run, which has no tasks left, and don't involve the workers
+        generation_.fetch_add(1);
+        for (std::size_t task = 0; task < num_tasks; ++task) {function(context, task);}
+        return;
+      }
+    }
+
+    function_.store(function, std::memory_order_relaxed);
+    context_.store(context, std::memory_order_relaxed);
+    num_tasks_.store(num_tasks, std::memory_order_relaxed);
+    next_task_.store(0, std::memory_order_relaxed);
+    pending_tasks_.store(num_tasks, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+
+    runTasks(function, context, num_tasks);
+
+    // Acquire the results of the tasks executed by the workers. Only the worker that claimed a task can complete it,
+    // so stop spinning at some point in case it shares the CPU of this thread with a lower priority
+    for (unsigned int spins = 0; pending_tasks_.load(std::memory_order_acquire) != 0; ++spins)
+    {
+      if (spins >= MAX_WAIT_SPINS) {boost::this_thread::sleep_for(boost::chrono::microseconds(1));}
+    }
+  }
+
+private:
+  boost::thread_group workers_;
+  bool                busy_wait_;
+
+  // Task parameters of the current run, only modified while the generation is odd and no worker is active
+  std::atomic<TaskFunction> function_;
+  std::atomic<void*>        context_;
+  std::atomic<std::size_t>  num_tasks_;
+
+  std::atomic<bool>        stop_;           ///< Set on destruction
+  std::atomic<std::size_t> generation_;     ///< Incremented twice on each run, odd while task parameters change
+  std::atomic<std::size_t> next_task_;      ///< Next task to be claimed
+  std::atomic<std::size_t> pending_tasks_;  ///< Tasks not yet completed
+  std::atomic<std::size_t> active_workers_; ///< Workers that joined a run and may still claim tasks from it
+
+  void init(const std::vector<int>& cpus, bool busy_wait, int priority)
+  {
+    busy_wait_ = busy_wait;
+    function_.store(0);
+    context_.store(0);
+    num_tasks_.store(0);
+    stop_.store(false);
+    generation_.store(0);
+    next_task_.store(0);
+    pending_tasks_.store(0);
+    active_workers_.store(0);
+
+    for (std::size_t i = 0; i < cpus.size(); ++i)
+    {
+      boost::thread* worker = new boost::thread(&PropagationWorkerPool::workerLoop, this);
+      workers_.add_thread(worker);
+      if (cpus[i] >= 0) {pin(*worker, cpus[i]);}
+      if (priority > 0) {setPriority(*worker, priority);}
+    }
+  }
+
+  static void pin(boost::thread& worker, int cpu)
+  {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    if (pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set), &cpu_set) != 0)
+    {
+      ROS_WARN_STREAM("Could not pin transmission propagation worker to CPU " << cpu << ".");
+    }
+#else
+    ROS_WARN_STREAM("Pinning transmission propagation workers to CPUs is not supported on this platform.");
+#endif
+  }
+
+  static void setPriority(boost::thread& worker, int priority)
+  {
+#ifdef __linux__
+    sched_param param;
+    param.sched_priority = priority;
+    if (pthread_setschedparam(worker.native_handle(), SCHED_FIFO, &param) != 0)
+    {
+      ROS_WARN_STREAM("Could not set the realtime priority of transmission propagation worker to " << priority << ".");
+    }
+#else
+    ROS_WARN_STREAM("Setting the priority of transmission propagation workers is not supported on this platform.");
+#endif
+  }
+
+  void runTasks(TaskFunction function, void* context, std::size_t num_tasks)
+  {
+    for (std::size_t task = next_task_.fetch_add(1, std::memory_order_relaxed); task < num_tasks;
+         task = next_task_.fetch_add(1, std::memory_order_relaxed))
+    {
+      function(context, task);
+      pending_tasks_.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  void workerLoop()
+  {
+    std::size_t seen_generation = 0;
+    while (!stop_.load(std::memory_order_relaxed))
+    {
+      const std::size_t generation = generation_.load(std::memory_order_acquire);
+      if (generation == seen_generation || (generation & 1))
+      {
+        if (!busy_wait_) {boost::this_thread::sleep_for(boost::chrono::microseconds(IDLE_SLEEP_US));}
+        continue;
+      }
+
+      // Join the run, unless the caller started replacing its parameters in the meantime. Sequentially consistent
+      // operations guarantee that either the caller sees this worker as active, or this worker sees the new generation
+      active_workers_.fetch_add(1);
+      if (generation_.load() == generation)
+      {
+        runTasks(function_.load(std::memory_order_relaxed),
+                 context_.load(std::memory_order_relaxed),
+                 num_tasks_.load(std::memory_order_relaxed));
+        seen_generation = generation;
+      }
+      active_workers_.fetch_sub(1, std::memory_order_release);
+    }
+  }
+};
+
+} // namespace
+
+#endif // header guard
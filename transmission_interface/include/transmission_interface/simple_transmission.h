@@ -147,6 +147,16 @@ public:
     return true;
   }
 
+  /**
+   * \brief Transform all state variables from actuator to joint space in a single pass.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Actuator and joint position, velocity and effort vectors must have size 1 and point to valid data.
+   *  Absolute position and torque sensor vectors are either empty, or have size 1 and point to valid data.
+   */
+  void actuatorToJointState(const ActuatorData& act_data,
+                                  JointData&    jnt_data);
+
   /**
    * \brief Transform \e effort variables from joint to actuator space.
    * \param[in]  jnt_data Joint-space variables.
@@ -185,6 +195,7 @@ public:
 
 private:
   double reduction_;
+  double inv_reduction_; ///< Reciprocal of the reduction, so that maps multiply instead of divide
   double jnt_offset_;
 };
 
@@ -192,12 +203,14 @@ inline SimpleTransmission::SimpleTransmission(const double reduction,
                                               const double joint_offset)
   : Transmission(),
     reduction_(reduction),
+    inv_reduction_(0.0),
     jnt_offset_(joint_offset)
 {
   if (0.0 == reduction_)
   {
     throw TransmissionInterfaceException("Transmission reduction ratio cannot be zero.");
   }
+  inv_reduction_ = 1.0 / reduction_;
 }
 
 inline void SimpleTransmission::actuatorToJointEffort(const ActuatorData& act_data,
@@ -215,7 +228,7 @@ inline void SimpleTransmission::actuatorToJointVelocity(const ActuatorData& act_
   assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
   assert(act_data.velocity[0] && jnt_data.velocity[0]);
 
-  *jnt_data.velocity[0] = *act_data.velocity[0] / reduction_;
+  *jnt_data.velocity[0] = *act_data.velocity[0] * inv_reduction_;
 }
 
 inline void SimpleTransmission::actuatorToJointPosition(const ActuatorData& act_data,
@@ -224,7 +237,7 @@ inline void SimpleTransmission::actuatorToJointPosition(const ActuatorData& act_
   assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
   assert(act_data.position[0] && jnt_data.position[0]);
 
-  *jnt_data.position[0] = *act_data.position[0] / reduction_ + jnt_offset_;
+  *jnt_data.position[0] = *act_data.position[0] * inv_reduction_ + jnt_offset_;
 }
 
 inline void SimpleTransmission::actuatorToJointAbsolutePosition(const ActuatorData& act_data,
@@ -233,7 +246,7 @@ inline void SimpleTransmission::actuatorToJointAbsolutePosition(const ActuatorDa
   assert(numActuators() == act_data.absolute_position.size() && numJoints() == jnt_data.absolute_position.size());
   assert(act_data.absolute_position[0] && jnt_data.absolute_position[0]);
 
-  *jnt_data.absolute_position[0] = *act_data.absolute_position[0] / reduction_ + jnt_offset_;
+  *jnt_data.absolute_position[0] = *act_data.absolute_position[0] * inv_reduction_ + jnt_offset_;
 }
 
 inline void SimpleTransmission::actuatorToJointTorqueSensor(const ActuatorData& act_data,
@@ -245,6 +258,31 @@ inline void SimpleTransmission::actuatorToJointTorqueSensor(const ActuatorData&
   *jnt_data.torque_sensor[0] = *act_data.torque_sensor[0] * reduction_;
 }
 
+inline void SimpleTransmission::actuatorToJointState(const ActuatorData& act_data,
+                                                           JointData&    jnt_data)
+{
+  assert(numActuators() == act_data.position.size() && numJoints() == jnt_data.position.size());
+  assert(numActuators() == act_data.velocity.size() && numJoints() == jnt_data.velocity.size());
+  assert(numActuators() == act_data.effort.size()   && numJoints() == jnt_data.effort.size());
+
+  const double reduction     = reduction_;
+  const double inv_reduction = inv_reduction_;
+  *jnt_data.position[0] = *act_data.position[0] * inv_reduction + jnt_offset_;
+  *jnt_data.velocity[0] = *act_data.velocity[0] * inv_reduction;
+  *jnt_data.effort[0]   = *act_data.effort[0] * reduction;
+
+  if (!act_data.absolute_position.empty())
+  {
+    assert(numJoints() == jnt_data.absolute_position.size());
+    *jnt_data.absolute_position[0] = *act_data.absolute_position[0] * inv_reduction + jnt_offset_;
+  }
+
+  if (!act_data.torque_sensor.empty())
+  {
+    assert(numJoints() == jnt_data.torque_sensor.size());
+    *jnt_data.torque_sensor[0] = *act_data.torque_sensor[0] * reduction;
+  }
+}
 
 inline void SimpleTransmission::jointToActuatorEffort(const JointData&    jnt_data,
                                                             ActuatorData& act_data)
@@ -252,7 +290,7 @@ inline void SimpleTransmission::jointToActuatorEffort(const JointData&    jnt_da
   assert(numActuators() == act_data.effort.size() && numJoints() == jnt_data.effort.size());
   assert(act_data.effort[0] && jnt_data.effort[0]);
 
-  *act_data.effort[0] = *jnt_data.effort[0] / reduction_;
+  *act_data.effort[0] = *jnt_data.effort[0] * inv_reduction_;
 }
 
 inline void SimpleTransmission::jointToActuatorVelocity(const JointData&    jnt_data,
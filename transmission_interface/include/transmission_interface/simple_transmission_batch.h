@@ -0,0 +1,276 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_H
+#define TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_H
+
+#include <cassert>
+#include <vector>
+
+#include <transmission_interface/simple_transmission.h>
+#include <transmission_interface/transmission.h>
+#include <transmission_interface/transmission_interface_exception.h>
+
+namespace transmission_interface
+{
+
+/**
+ * \brief Engine for propagating the maps of a set of simple reducer transmissions in a single pass.
+ *
+ * Propagating maps through individual \ref SimpleTransmission instances requires one virtual call and several pointer
+ * indirections per transmission. This class instead stores the reduction and offset of all its transmissions in
+ * contiguous arrays, and propagates each map in three steps: gather the input values into a contiguous buffer,
+ * compute the outputs in a loop that the compiler can vectorize, and scatter the results to their destination.
+ *
+ * Results are identical to those obtained by calling the corresponding \ref SimpleTransmission methods.
+ *
+ * Transmissions need not provide data for all variables. Each map is evaluated only on the transmissions that were
+ * added with data for the variable it transforms, eg. transmissions without effort data are skipped by
+ * \ref actuatorToJointEffort.
+ *
+ * \code
+ * SimpleTransmissionBatch batch;
+ * batch.addTransmission(trans_1, a_data_1, j_data_1);
+ * batch.addTransmission(trans_2, a_data_2, j_data_2);
+ *
+ * // In the control loop
+ * batch.actuatorToJointState();
+ * ...
+ * batch.jointToActuatorPosition();
+ * \endcode
+ *
+ * \note The lifecycle of the raw data pointed to by the transmission data is not handled by this class.
+ */
+class SimpleTransmissionBatch
+{
+public:
+  SimpleTransmissionBatch() : size_(0) {}
+
+  /** \return Number of transmissions in the batch. */
+  std::size_t size() const {return size_;}
+
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Add a transmission to the batch.
+   * \param transmission Transmission whose reduction and offset will be used. It is copied, so it need not outlive the
+   * batch.
+   * \param act_data Actuator-space variables.
+   * \param jnt_data Joint-space variables.
+   * \pre For each variable, actuator and joint data must be either both empty or both of size one, with valid
+   * pointers. Otherwise an exception is thrown.
+   */
+  void addTransmission(const SimpleTransmission& transmission,
+                       const ActuatorData&       act_data,
+                       const JointData&          jnt_data)
+  {
+    // Validate everything before modifying the batch, so that failures leave it unchanged
+    validate(act_data.position,          jnt_data.position,          "position");
+    validate(act_data.velocity,          jnt_data.velocity,          "velocity");
+    validate(act_data.effort,            jnt_data.effort,            "effort");
+    validate(act_data.absolute_position, jnt_data.absolute_position, "absolute position");
+    validate(act_data.torque_sensor,     jnt_data.torque_sensor,     "torque sensor");
+
+    const double reduction = transmission.getActuatorReduction();
+    const double offset    = transmission.getJointOffset();
+    position_.add(act_data.position,                   jnt_data.position,          reduction, offset);
+    velocity_.add(act_data.velocity,                   jnt_data.velocity,          reduction, offset);
+    effort_.add(act_data.effort,                       jnt_data.effort,            reduction, offset);
+    absolute_position_.add(act_data.absolute_position, jnt_data.absolute_position, reduction, offset);
+    torque_sensor_.add(act_data.torque_sensor,         jnt_data.torque_sensor,     reduction, offset);
+    ++size_;
+  }
+
+  /*\}*/
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /** \brief Transform \e effort variables from actuator to joint space. \sa SimpleTransmission::actuatorToJointEffort */
+  void actuatorToJointEffort()
+  {
+    Field& f = effort_;
+    f.gather(f.act_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.reduction[i];}
+    f.scatter(f.jnt_ptrs);
+  }
+
+  /** \brief Transform \e velocity variables from actuator to joint space. \sa SimpleTransmission::actuatorToJointVelocity */
+  void actuatorToJointVelocity()
+  {
+    Field& f = velocity_;
+    f.gather(f.act_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.inv_reduction[i];}
+    f.scatter(f.jnt_ptrs);
+  }
+
+  /** \brief Transform \e position variables from actuator to joint space. \sa SimpleTransmission::actuatorToJointPosition */
+  void actuatorToJointPosition()
+  {
+    actuatorToJointPosition(position_);
+  }
+
+  /** \brief Transform \e absolute position variables from actuator to joint space. */
+  void actuatorToJointAbsolutePosition()
+  {
+    actuatorToJointPosition(absolute_position_);
+  }
+
+  /** \brief Transform \e torque sensor variables from actuator to joint space. */
+  void actuatorToJointTorqueSensor()
+  {
+    Field& f = torque_sensor_;
+    f.gather(f.act_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.reduction[i];}
+    f.scatter(f.jnt_ptrs);
+  }
+
+  /**
+   * \brief Transform all state variables from actuator to joint space.
+   *
+   * This is equivalent to propagating the maps of an \ref ActuatorToJointStateHandle on every transmission of the
+   * batch.
+   */
+  void actuatorToJointState()
+  {
+    actuatorToJointPosition();
+    actuatorToJointVelocity();
+    actuatorToJointEffort();
+    actuatorToJointAbsolutePosition();
+    actuatorToJointTorqueSensor();
+  }
+
+  /** \brief Transform \e effort variables from joint to actuator space. \sa SimpleTransmission::jointToActuatorEffort */
+  void jointToActuatorEffort()
+  {
+    Field& f = effort_;
+    f.gather(f.jnt_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.inv_reduction[i];}
+    f.scatter(f.act_ptrs);
+  }
+
+  /** \brief Transform \e velocity variables from joint to actuator space. \sa SimpleTransmission::jointToActuatorVelocity */
+  void jointToActuatorVelocity()
+  {
+    Field& f = velocity_;
+    f.gather(f.jnt_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.reduction[i];}
+    f.scatter(f.act_ptrs);
+  }
+
+  /** \brief Transform \e position variables from joint to actuator space. \sa SimpleTransmission::jointToActuatorPosition */
+  void jointToActuatorPosition()
+  {
+    Field& f = position_;
+    f.gather(f.jnt_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = (f.in[i] - f.offset[i]) * f.reduction[i];}
+    f.scatter(f.act_ptrs);
+  }
+
+  /**
+   * \brief Transform position, velocity and effort variables from joint to actuator space.
+   *
+   * This is equivalent to propagating the maps of a \ref JointToActuatorStateHandle on every transmission of the batch.
+   */
+  void jointToActuatorState()
+  {
+    jointToActuatorPosition();
+    jointToActuatorVelocity();
+    jointToActuatorEffort();
+  }
+
+  /*\}*/
+
+private:
+  /** \brief Structure of arrays with the data required to map a single variable on all transmissions of the batch. */
+  struct Field
+  {
+    std::size_t size() const {return act_ptrs.size();}
+
+    void add(const std::vector<double*>& act, const std::vector<double*>& jnt, double red, double off)
+    {
+      if (act.empty()) {return;}
+      act_ptrs.push_back(act[0]);
+      jnt_ptrs.push_back(jnt[0]);
+      reduction.push_back(red);
+      inv_reduction.push_back(1.0 / red);
+      offset.push_back(off);
+      in.push_back(0.0);
+      out.push_back(0.0);
+    }
+
+    void gather(const std::vector<double*>& src)
+    {
+      for (std::size_t i = 0; i < src.size(); ++i) {in[i] = *src[i];}
+    }
+
+    void scatter(const std::vector<double*>& dst) const
+    {
+      for (std::size_t i = 0; i < dst.size(); ++i) {*dst[i] = out[i];}
+    }
+
+    std::vector<double*> act_ptrs;
+    std::vector<double*> jnt_ptrs;
+    std::vector<double>  reduction;
+    std::vector<double>  inv_reduction; ///< Reciprocal of the reductions, same as in SimpleTransmission
+    std::vector<double>  offset;
+    std::vector<double>  in;  ///< Gathered input values
+    std::vector<double>  out; ///< Computed output values, before being scattered
+  };
+
+  std::size_t size_;
+  Field position_;
+  Field velocity_;
+  Field effort_;
+  Field absolute_position_;
+  Field torque_sensor_;
+
+  void actuatorToJointPosition(Field& f)
+  {
+    f.gather(f.act_ptrs);
+    for (std::size_t i = 0; i < f.size(); ++i) {f.out[i] = f.in[i] * f.inv_reduction[i] + f.offset[i];}
+    f.scatter(f.jnt_ptrs);
+  }
+
+  static void validate(const std::vector<double*>& act, const std::vector<double*>& jnt, const std::string& variable)
+  {
+    if (act.size() != jnt.size() || act.size() > 1)
+    {
+      throw TransmissionInterfaceException("Simple transmission " + variable + " data must contain either none or one "
+                                           "actuator and joint values.");
+    }
+    if (!act.empty() && (!act[0] || !jnt[0]))
+    {
+      throw TransmissionInterfaceException("Simple transmission " + variable + " data contains null pointers.");
+    }
+  }
+};
+
+} // transmission_interface
+
+#endif // TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_H
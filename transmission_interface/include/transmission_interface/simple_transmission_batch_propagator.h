@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_PROPAGATOR_H
+#define TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_PROPAGATOR_H
+
+#include <map>
+#include <typeinfo>
+#include <vector>
+
+#include <transmission_interface/simple_transmission.h>
+#include <transmission_interface/simple_transmission_batch.h>
+#include <transmission_interface/transmission_interface.h>
+
+namespace transmission_interface
+{
+
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+// Batch map equivalent to propagating a handle of a given type
+template <class HandleType> struct BatchMap;
+
+template <> struct BatchMap<ActuatorToJointStateHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.actuatorToJointState();}
+};
+
+template <> struct BatchMap<ActuatorToJointPositionHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.actuatorToJointPosition();}
+};
+
+template <> struct BatchMap<ActuatorToJointVelocityHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.actuatorToJointVelocity();}
+};
+
+template <> struct BatchMap<ActuatorToJointEffortHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.actuatorToJointEffort();}
+};
+
+template <> struct BatchMap<JointToActuatorStateHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.jointToActuatorState();}
+};
+
+template <> struct BatchMap<JointToActuatorPositionHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.jointToActuatorPosition();}
+};
+
+template <> struct BatchMap<JointToActuatorVelocityHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.jointToActuatorVelocity();}
+};
+
+template <> struct BatchMap<JointToActuatorEffortHandle>
+{
+  static void propagate(SimpleTransmissionBatch& batch) {batch.jointToActuatorEffort();}
+};
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief Propagates the \ref SimpleTransmission handles of a \ref TransmissionInterface as a
+ * \ref SimpleTransmissionBatch.
+ *
+ * Handles of simple transmissions are gathered into a batch, which is propagated before the remaining handles. Only
+ * handles whose data is not accessed by any other handle of the interface are batched, so that propagating them out
+ * of order yields the same results as serial propagation. Other handles, eg. of differentials or of simple
+ * transmissions sharing data, are propagated one by one, in serial propagation order.
+ *
+ * \code
+ * robot_transmissions.get<ActuatorToJointStateInterface>()->setPropagator(
+ *   boost::make_shared<SimpleTransmissionBatchPropagator<ActuatorToJointStateHandle> >());
+ * \endcode
+ *
+ * \tparam HandleType One of the %transmission handle types declared in transmission_interface.h.
+ */
+template <class HandleType>
+class SimpleTransmissionBatchPropagator : public HandlePropagator<HandleType>
+{
+public:
+  /** \return Number of handles propagated as a batch. */
+  std::size_t getBatchSize() const {return batch_.size();}
+
+  void setHandles(const std::vector<HandleType>& handles)
+  {
+    batch_ = SimpleTransmissionBatch();
+    other_handles_.clear();
+
+    // Count the handles accessing each datum
+    std::vector<std::vector<const double*> > data(handles.size());
+    std::map<const double*, std::size_t> data_users;
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+      internal::getDataPointers(static_cast<const TransmissionHandle&>(handles[i]), data[i]);
+      for (std::size_t j = 0; j < data[i].size(); ++j) {++data_users[data[i][j]];}
+    }
+
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+      if (!addToBatch(handles[i], data[i], data_users)) {other_handles_.push_back(handles[i]);}
+    }
+  }
+
+  void propagate()
+  {
+    internal::BatchMap<HandleType>::propagate(batch_);
+
+    typedef typename std::vector<HandleType>::iterator IteratorType;
+    for (IteratorType it = other_handles_.begin(); it != other_handles_.end(); ++it)
+    {
+      it->propagate();
+    }
+  }
+
+private:
+  SimpleTransmissionBatch batch_;
+  std::vector<HandleType> other_handles_;
+
+  bool addToBatch(const HandleType&                           handle,
+                  const std::vector<const double*>&           data,
+                  const std::map<const double*, std::size_t>& data_users)
+  {
+    // Subclasses of SimpleTransmission may override its maps
+    const Transmission* transmission = handle.getTransmission();
+    if (!transmission || typeid(*transmission) != typeid(SimpleTransmission)) {return false;}
+
+    for (std::size_t j = 0; j < data.size(); ++j)
+    {
+      if (data_users.find(data[j])->second > 1) {return false;}
+    }
+
+    try
+    {
+      batch_.addTransmission(static_cast<const SimpleTransmission&>(*transmission),
+                             handle.getActuatorData(),
+                             handle.getJointData());
+    }
+    catch (const TransmissionInterfaceException&)
+    {
+      return false; // Data layout not supported by the batch
+    }
+    return true;
+  }
+};
+
+} // transmission_interface
+
+#endif // TRANSMISSION_INTERFACE_SIMPLE_TRANSMISSION_BATCH_PROPAGATOR_H
@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_STATIC_TRANSMISSION_PIPELINE_H
+#define TRANSMISSION_INTERFACE_STATIC_TRANSMISSION_PIPELINE_H
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include <hardware_interface/internal/demangle_symbol.h>
+#include <transmission_interface/fixed_transmission_data.h>
+#include <transmission_interface/robot_transmissions.h>
+#include <transmission_interface/transmission.h>
+#include <transmission_interface/transmission_info.h>
+#include <transmission_interface/transmission_interface.h>
+#include <transmission_interface/transmission_interface_exception.h>
+
+namespace transmission_interface
+{
+
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+template <std::size_t... Is> struct IndexSequence {};
+
+template <std::size_t N, std::size_t... Is>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+template <std::size_t... Is>
+struct MakeIndexSequence<0, Is...> {typedef IndexSequence<Is...> type;};
+
+// Actuator and joint data of a single map. Maps not exposed by the runtime transmission interfaces are disabled.
+// Data is fixed-size for transmissions with fixed-size overloads of their maps, see FixedDataSize
+template <std::size_t N>
+struct StaticMapData
+{
+  StaticMapData() : enabled(false) {}
+
+  void set(const StaticMapData<0>& data);
+
+  bool                 enabled;
+  FixedActuatorData<N> act_data;
+  FixedJointData<N>    jnt_data;
+};
+
+template <>
+struct StaticMapData<0>
+{
+  StaticMapData() : enabled(false) {}
+
+  void set(const StaticMapData<0>& data) {*this = data;}
+
+  bool         enabled;
+  ActuatorData act_data;
+  JointData    jnt_data;
+};
+
+template <std::size_t N>
+void StaticMapData<N>::set(const StaticMapData<0>& data)
+{
+  enabled = data.enabled;
+  if (!enabled) {return;}
+  act_data = toFixedActuatorData<N>(data.act_data);
+  jnt_data = toFixedJointData<N>(data.jnt_data);
+}
+
+// A transmission stored by value, so that its maps can be called without virtual dispatch, and the data of its maps
+template <class TransmissionType>
+struct StaticTransmissionStage
+{
+  typedef StaticMapData<FixedDataSize<TransmissionType>::value> MapData;
+
+  explicit StaticTransmissionStage(const TransmissionType& trans) : transmission(trans) {}
+
+  TransmissionType transmission;
+  MapData          state;
+  MapData          pos_cmd;
+  MapData          vel_cmd;
+  MapData          eff_cmd;
+};
+
+// Maps, as function objects applied to each stage. Calls are qualified with the transmission type, which disables
+// virtual dispatch
+
+struct StaticActuatorToJointState
+{
+  template <class T> void operator()(StaticTransmissionStage<T>& s) const
+  {
+    if (s.state.enabled) {s.transmission.T::actuatorToJointState(s.state.act_data, s.state.jnt_data);}
+  }
+};
+
+struct StaticJointToActuatorPosition
+{
+  template <class T> void operator()(StaticTransmissionStage<T>& s) const
+  {
+    if (s.pos_cmd.enabled) {s.transmission.T::jointToActuatorPosition(s.pos_cmd.jnt_data, s.pos_cmd.act_data);}
+  }
+};
+
+struct StaticJointToActuatorVelocity
+{
+  template <class T> void operator()(StaticTransmissionStage<T>& s) const
+  {
+    if (s.vel_cmd.enabled) {s.transmission.T::jointToActuatorVelocity(s.vel_cmd.jnt_data, s.vel_cmd.act_data);}
+  }
+};
+
+struct StaticJointToActuatorEffort
+{
+  template <class T> void operator()(StaticTransmissionStage<T>& s) const
+  {
+    if (s.eff_cmd.enabled) {s.transmission.T::jointToActuatorEffort(s.eff_cmd.jnt_data, s.eff_cmd.act_data);}
+  }
+};
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief Statically typed pipeline for propagating the maps of a fixed set of transmissions.
+ *
+ * Transmissions loaded by \ref TransmissionInterfaceLoader are stored behind \ref Transmission pointers, and each map
+ * is propagated with one virtual call per transmission. When the transmission layout of a robot is known at compile
+ * time, this class can be used instead in the control loop: the type of each transmission is a template parameter, so
+ * maps are called without virtual dispatch and can be inlined into a single propagation function.
+ *
+ * The pipeline is built from the transmissions loaded at runtime, which keep owning the joint and actuator data. The
+ * transmission specification is passed in the same order as the template parameters, and only identifies the
+ * transmissions by name. Each stage stores a copy of the loaded transmission, checked to have exactly the expected
+ * type, rather than loading it again from its specification: the copy is configured exactly like the transmission
+ * propagated by the runtime interfaces, and building the pipeline neither parses XML again nor requires linking the
+ * loader plugins. Maps are propagated on the transmissions for which the corresponding interface of
+ * \ref RobotTransmissions has a handle, like when propagating the runtime interfaces. Transmissions specializing
+ * \ref FixedDataSize, like \ref DifferentialTransmission, are passed fixed-size data.
+ *
+ * \code
+ * // Robot with a simple reducer and a differential wrist
+ * typedef StaticTransmissionPipeline<SimpleTransmission, DifferentialTransmission> Pipeline;
+ *
+ * // Initialization. infos are the transmissions of the robot description, in template parameter order
+ * transmission_loader.load(infos);
+ * Pipeline pipeline(infos, robot_transmissions);
+ *
+ * // In the control loop
+ * pipeline.actuatorToJointState();
+ * ...
+ * pipeline.jointToActuatorPosition();
+ * \endcode
+ *
+ * \tparam Transmissions Exact types of the transmissions of the pipeline.
+ * \note The runtime transmission interfaces remain usable, and propagate the same data.
+ */
+template <class... Transmissions>
+class StaticTransmissionPipeline
+{
+  typedef std::tuple<internal::StaticTransmissionStage<Transmissions>...> Stages;
+
+public:
+  /**
+   * \param transmission_info Specification of the pipeline transmissions, in template parameter order.
+   * \param robot_transmissions Transmission interfaces populated with the specified transmissions, eg. by a
+   * \ref TransmissionInterfaceLoader.
+   * \pre There must be one transmission specification per template parameter, and the loaded transmission with the
+   * specified name must exactly have the type of its template parameter. Otherwise an exception is thrown.
+   */
+  StaticTransmissionPipeline(const std::vector<TransmissionInfo>& transmission_info,
+                             RobotTransmissions&                  robot_transmissions)
+    : StaticTransmissionPipeline(transmission_info,
+                                 robot_transmissions,
+                                 typename internal::MakeIndexSequence<sizeof...(Transmissions)>::type())
+  {}
+
+  /** \return Number of transmissions in the pipeline. */
+  static std::size_t size() {return sizeof...(Transmissions);}
+
+  /** \return Name of the \e i-th transmission of the pipeline. */
+  const std::string& getName(std::size_t i) const {return names_[i];}
+
+  /** \return The \e I-th transmission of the pipeline. */
+  template <std::size_t I>
+  const typename std::tuple_element<I, std::tuple<Transmissions...> >::type& getTransmission() const
+  {
+    return std::get<I>(stages_).transmission;
+  }
+
+  /** \name Real-Time Safe Functions
+   *\{*/
+
+  /** \brief Propagate actuator state to joint state. \sa ActuatorToJointStateInterface */
+  void actuatorToJointState() {forEach(internal::StaticActuatorToJointState());}
+
+  /** \brief Propagate joint position commands to actuators. \sa JointToActuatorPositionInterface */
+  void jointToActuatorPosition() {forEach(internal::StaticJointToActuatorPosition());}
+
+  /** \brief Propagate joint velocity commands to actuators. \sa JointToActuatorVelocityInterface */
+  void jointToActuatorVelocity() {forEach(internal::StaticJointToActuatorVelocity());}
+
+  /** \brief Propagate joint effort commands to actuators. \sa JointToActuatorEffortInterface */
+  void jointToActuatorEffort() {forEach(internal::StaticJointToActuatorEffort());}
+
+  /*\}*/
+
+private:
+  std::vector<std::string> names_;
+  Stages                   stages_;
+
+  template <std::size_t... Is>
+  StaticTransmissionPipeline(const std::vector<TransmissionInfo>& transmission_info,
+                             RobotTransmissions&                  robot_transmissions,
+                             internal::IndexSequence<Is...>)
+    : names_(getNames(transmission_info)),
+      stages_(makeStage<Transmissions>(names_[Is], robot_transmissions)...)
+  {}
+
+  static std::vector<std::string> getNames(const std::vector<TransmissionInfo>& transmission_info)
+  {
+    if (transmission_info.size() != sizeof...(Transmissions))
+    {
+      throw TransmissionInterfaceException("Static transmission pipeline expects " +
+                                           std::to_string(sizeof...(Transmissions)) +
+                                           " transmissions, but " + std::to_string(transmission_info.size()) +
+                                           " were specified.");
+    }
+
+    std::vector<std::string> names;
+    names.reserve(transmission_info.size());
+    for (std::size_t i = 0; i < transmission_info.size(); ++i) {names.push_back(transmission_info[i].name_);}
+    return names;
+  }
+
+  /**
+   * \brief Get the data of a map from the handle of a runtime transmission interface.
+   * \param[in,out] transmission Transmission of the handle. Set if null, otherwise checked for consistency.
+   */
+  template <class InterfaceType, class HandleType>
+  static internal::StaticMapData<0> getMapData(const std::string&  name,
+                                               RobotTransmissions& robot_transmissions,
+                                               Transmission*&      transmission)
+  {
+    internal::StaticMapData<0> map_data;
+
+    InterfaceType* iface = robot_transmissions.get<InterfaceType>();
+    if (!iface) {return map_data;}
+
+    if (!iface->hasHandle(name)) {return map_data;}
+
+    const HandleType handle = iface->getHandle(name);
+    if (transmission && transmission != handle.getTransmission())
+    {
+      throw TransmissionInterfaceException("Transmission '" + name +
+                                           "' refers to different instances in its transmission interfaces.");
+    }
+    transmission = handle.getTransmission();
+
+    map_data.enabled  = true;
+    map_data.act_data = handle.getActuatorData();
+    map_data.jnt_data = handle.getJointData();
+    return map_data;
+  }
+
+  template <class TransmissionType>
+  static internal::StaticTransmissionStage<TransmissionType> makeStage(const std::string&  name,
+                                                                       RobotTransmissions& robot_transmissions)
+  {
+    Transmission* transmission = 0;
+    const internal::StaticMapData<0> state =
+      getMapData<ActuatorToJointStateInterface, ActuatorToJointStateHandle>(
+        name, robot_transmissions, transmission);
+    const internal::StaticMapData<0> pos_cmd =
+      getMapData<JointToActuatorPositionInterface, JointToActuatorPositionHandle>(
+        name, robot_transmissions, transmission);
+    const internal::StaticMapData<0> vel_cmd =
+      getMapData<JointToActuatorVelocityInterface, JointToActuatorVelocityHandle>(
+        name, robot_transmissions, transmission);
+    const internal::StaticMapData<0> eff_cmd =
+      getMapData<JointToActuatorEffortInterface, JointToActuatorEffortHandle>(
+        name, robot_transmissions, transmission);
+
+    if (!transmission)
+    {
+      throw TransmissionInterfaceException("Transmission '" + name + "' was not found in any transmission interface.");
+    }
+
+    // Calls to the maps bypass virtual dispatch, so the type must match exactly, not only be a base class
+    if (typeid(*transmission) != typeid(TransmissionType))
+    {
+      throw TransmissionInterfaceException("Transmission '" + name + "' is of type '" +
+                                           hardware_interface::internal::demangledTypeName(*transmission) +
+                                           "', but the static transmission pipeline expects '" +
+                                           hardware_interface::internal::demangledTypeName<TransmissionType>() +
+                                           "'.");
+    }
+
+    internal::StaticTransmissionStage<TransmissionType> stage(*static_cast<TransmissionType*>(transmission));
+    stage.state.set(state);
+    stage.pos_cmd.set(pos_cmd);
+    stage.vel_cmd.set(vel_cmd);
+    stage.eff_cmd.set(eff_cmd);
+    return stage;
+  }
+
+  template <std::size_t I = 0, class MapType>
+  typename std::enable_if<(I < sizeof...(Transmissions))>::type forEach(const MapType& map)
+  {
+    map(std::get<I>(stages_));
+    forEach<I + 1>(map);
+  }
+
+  template <std::size_t I = 0, class MapType>
+  typename std::enable_if<(I == sizeof...(Transmissions))>::type forEach(const MapType&) {}
+};
+
+} // namespace
+
+#endif // header guard
@@ -139,6 +139,37 @@ public:
 
   virtual bool hasActuatorToJointTorqueSensor() = 0;
 
+  /**
+   * \brief Transform all state variables from actuator to joint space.
+   *
+   * Position, velocity and effort are always transformed. Absolute position and torque sensor variables are
+   * transformed if actuator data for them is available and the transmission supports them.
+   *
+   * The default implementation calls the individual maps. Transmissions can override this method to transform all
+   * variables in a single pass over their data.
+   * \param[in]  act_data Actuator-space variables.
+   * \param[out] jnt_data Joint-space variables.
+   * \pre Position, velocity and effort vectors must contain valid data and their size should be consistent with the
+   * number of transmission actuators and joints. Absolute position and torque sensor vectors can remain empty.
+   */
+  virtual void actuatorToJointState(const ActuatorData& act_data,
+                                          JointData&    jnt_data)
+  {
+    actuatorToJointPosition(act_data, jnt_data);
+    actuatorToJointVelocity(act_data, jnt_data);
+    actuatorToJointEffort(act_data, jnt_data);
+
+    if (!act_data.absolute_position.empty() && hasActuatorToJointAbsolutePosition())
+    {
+      actuatorToJointAbsolutePosition(act_data, jnt_data);
+    }
+
+    if (!act_data.torque_sensor.empty() && hasActuatorToJointTorqueSensor())
+    {
+      actuatorToJointTorqueSensor(act_data, jnt_data);
+    }
+  }
+
   /**
    * \brief Transform \e effort variables from joint to actuator space.
    * \param[in]  jnt_data Joint-space variables.
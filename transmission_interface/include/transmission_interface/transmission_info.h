@@ -42,9 +42,13 @@
 #define TRANSMISSION_INTERFACE_TRANSMISSION_INTERFACE_INFO_H
 
 // C++ standard
+#include <sstream>
 #include <vector>
 #include <string>
 
+// Boost
+#include <boost/shared_ptr.hpp>
+
 // TinyXML
 #include <tinyxml.h>
 
@@ -59,7 +63,8 @@ struct JointInfo
   std::string name_;
   std::vector<std::string> hardware_interfaces_;
   std::string role_;
-  std::string xml_element_;
+  std::string xml_element_; ///< Left empty if \c xml_element_ptr_ is set, see \ref getXmlElementString
+  boost::shared_ptr<const TiXmlElement> xml_element_ptr_; ///< Parsed XML element. Optional
 };
 
 /**
@@ -69,7 +74,8 @@ struct ActuatorInfo
 {
   std::string name_;
   std::vector<std::string> hardware_interfaces_;
-  std::string xml_element_;
+  std::string xml_element_; ///< Left empty if \c xml_element_ptr_ is set, see \ref getXmlElementString
+  boost::shared_ptr<const TiXmlElement> xml_element_ptr_; ///< Parsed XML element. Optional
 };
 
 /**
@@ -83,6 +89,23 @@ struct TransmissionInfo
   std::vector<ActuatorInfo> actuators_;
 };
 
+/**
+ * \brief String representation of the XML element of a joint or actuator.
+ *
+ * The transmission parser only fills \c xml_element_ when it can't provide the parsed element in \c xml_element_ptr_,
+ * so the string is built from the latter if needed.
+ * \tparam Info \ref JointInfo or \ref ActuatorInfo.
+ */
+template <class Info>
+std::string getXmlElementString(const Info& info)
+{
+  if (!info.xml_element_.empty() || !info.xml_element_ptr_) {return info.xml_element_;}
+
+  std::stringstream element_stream;
+  element_stream << *info.xml_element_ptr_;
+  return element_stream.str();
+}
+
 } // namespace
 
 #endif
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * \file
+ * \brief Binary cache of the transmissions parsed from a robot description.
+ */
+
+#ifndef TRANSMISSION_INTERFACE_TRANSMISSION_INFO_CACHE_H
+#define TRANSMISSION_INTERFACE_TRANSMISSION_INFO_CACHE_H
+
+// C++ standard
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// ros_control
+#include <transmission_interface/transmission_info.h>
+
+namespace transmission_interface
+{
+
+/// Identifier and version of the layout of transmission cache files. Must change whenever the layout changes.
+const uint32_t TRANSMISSION_CACHE_FORMAT = 0x54490001;
+
+/**
+ * \param urdf Robot description.
+ * \return Key identifying the transmissions of \p urdf in a cache file.
+ */
+uint64_t transmissionCacheKey(const std::string& urdf);
+
+/**
+ * \brief Store transmission information in a cache file.
+ *
+ * Cache files can be read back much faster than parsing a robot description, which shortens process restarts.
+ * \param path Cache file path.
+ * \param key Key identifying the data \p transmissions were obtained from, see \ref transmissionCacheKey.
+ * \param transmissions Transmission information to store.
+ * \return True if successful.
+ */
+bool writeTransmissionCache(const std::string&                   path,
+                            uint64_t                             key,
+                            const std::vector<TransmissionInfo>& transmissions);
+
+/**
+ * \brief Read transmission information from a cache file.
+ *
+ * The pre-parsed XML elements of joints and actuators are cached as strings, so \ref JointInfo::xml_element_ptr_ and
+ * \ref ActuatorInfo::xml_element_ptr_ are left unset and the string representations are set instead.
+ * \param path Cache file path.
+ * \param key Expected key of the cached data, see \ref transmissionCacheKey.
+ * \param[out] transmissions Cached transmission information. Left unchanged if reading fails.
+ * \return True if the cache file exists, is valid and matches \p key.
+ */
+bool readTransmissionCache(const std::string&             path,
+                           uint64_t                       key,
+                           std::vector<TransmissionInfo>& transmissions);
+
+} // namespace
+
+#endif // header guard
@@ -30,10 +30,14 @@
 #ifndef TRANSMISSION_INTERFACE_TRANSMISSION_INTERFACE_H
 #define TRANSMISSION_INTERFACE_TRANSMISSION_INTERFACE_H
 
-#include <map>
+#include <algorithm>
 #include <string>
 #include <vector>
 
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
 #include <hardware_interface/internal/resource_manager.h>
 #include <transmission_interface/transmission.h>
 #include <transmission_interface/transmission_interface_exception.h>
@@ -42,42 +46,33 @@ namespace transmission_interface
 {
 
 /**
- * \brief Handle for propagating a single map (position, velocity, or effort) on a single transmission
- * (eg. actuator to joint effort for a simple reducer).
+ * \brief %Transmission and actuator and joint data propagated by a transmission handle.
+ *
+ * Data is validated once on construction, and is immutable afterwards. Handles built from the same instance share it,
+ * so that creating and copying handles, eg. when registering them in a \ref TransmissionInterface, neither repeats the
+ * validation nor copies the data vectors.
  */
-class TransmissionHandle
+class ValidatedTransmissionData
 {
 public:
-  /** \return Transmission name. */
-  std::string getName() const {return name_;}
-
-protected:
-  std::string   name_;
-  Transmission* transmission_;
-  ActuatorData  actuator_data_;
-  JointData     joint_data_;
-
   /**
-   * \param name %Transmission name.
    * \param transmission Pointer to transmission instance.
    * \param actuator_data Actuator-space variables.
    * \param joint_data Joint-space variables.
    * \note The lifecycle of the pointed-to instances passed as parameters is not handled by this class.
-   * \pre Valid transmission pointer. Actuator and joint variable vectors required by this handle must contain valid
-   * data and their size should be consistent with the number of transmission actuators and joints.
-   * Data vectors not used by this handle can remain empty.
+   * \pre Valid transmission pointer. Actuator and joint variable vectors required by the handles using this data must
+   * contain valid data and their size should be consistent with the number of transmission actuators and joints.
+   * Data vectors not used by the handles can remain empty. Otherwise an exception is thrown.
    */
-  TransmissionHandle(const std::string&  name,
-                     Transmission*       transmission,
-                     const ActuatorData& actuator_data,
-                     const JointData&    joint_data)
-    : name_(name),
-      transmission_(transmission),
+  ValidatedTransmissionData(Transmission*       transmission,
+                            const ActuatorData& actuator_data,
+                            const JointData&    joint_data)
+    : transmission_(transmission),
       actuator_data_(actuator_data),
       joint_data_(joint_data)
   {
     // Precondition: Valid transmission
-    if (!transmission_)
+    if (!transmission)
     {
       throw TransmissionInterfaceException("Unspecified transmission.");
     }
@@ -90,44 +85,44 @@ protected:
     }
 
     // Precondition: All non-empty data vectors must have sizes consistent with the transmission
-    if (!actuator_data.position.empty() && actuator_data.position.size() != transmission_->numActuators())
+    if (!actuator_data.position.empty() && actuator_data.position.size() != transmission->numActuators())
     {
       throw TransmissionInterfaceException("Actuator position data size does not match transmission.");
     }
-    if (!actuator_data.velocity.empty() && actuator_data.velocity.size() != transmission_->numActuators())
+    if (!actuator_data.velocity.empty() && actuator_data.velocity.size() != transmission->numActuators())
     {
       throw TransmissionInterfaceException("Actuator velocity data size does not match transmission.");
     }
-    if (!actuator_data.effort.empty() && actuator_data.effort.size() != transmission_->numActuators())
+    if (!actuator_data.effort.empty() && actuator_data.effort.size() != transmission->numActuators())
     {
       throw TransmissionInterfaceException("Actuator effort data size does not match transmission.");
     }
-    if (!actuator_data.absolute_position.empty() && actuator_data.absolute_position.size() != transmission_->numActuators())
+    if (!actuator_data.absolute_position.empty() && actuator_data.absolute_position.size() != transmission->numActuators())
     {
       throw TransmissionInterfaceException("Actuator absolute position data size does not match transmission.");
     }
-    if (!actuator_data.absolute_position.empty() && actuator_data.absolute_position.size() != transmission_->numActuators())
+    if (!actuator_data.torque_sensor.empty() && actuator_data.torque_sensor.size() != transmission->numActuators())
     {
       throw TransmissionInterfaceException("Actuator torque sensor data size does not match transmission.");
     }
 
-    if (!joint_data.position.empty() && joint_data.position.size() != transmission_->numJoints())
+    if (!joint_data.position.empty() && joint_data.position.size() != transmission->numJoints())
     {
       throw TransmissionInterfaceException("Joint position data size does not match transmission.");
     }
-    if (!joint_data.velocity.empty() && joint_data.velocity.size() != transmission_->numJoints())
+    if (!joint_data.velocity.empty() && joint_data.velocity.size() != transmission->numJoints())
     {
       throw TransmissionInterfaceException("Joint velocity data size does not match transmission.");
     }
-    if (!joint_data.effort.empty() && joint_data.effort.size() != transmission_->numJoints())
+    if (!joint_data.effort.empty() && joint_data.effort.size() != transmission->numJoints())
     {
       throw TransmissionInterfaceException("Joint effort data size does not match transmission.");
     }
-    if (!joint_data.absolute_position.empty() && joint_data.absolute_position.size() != transmission_->numJoints())
+    if (!joint_data.absolute_position.empty() && joint_data.absolute_position.size() != transmission->numJoints())
     {
       throw TransmissionInterfaceException("Joint absolute position data size does not match transmission.");
     }
-    if (!joint_data.torque_sensor.empty() && joint_data.torque_sensor.size() != transmission_->numJoints())
+    if (!joint_data.torque_sensor.empty() && joint_data.torque_sensor.size() != transmission->numJoints())
     {
       throw TransmissionInterfaceException("Joint torque sensor data size does not match transmission.");
     }
@@ -174,10 +169,24 @@ protected:
     {
       throw TransmissionInterfaceException("Joint torque sensor data contains null pointers.");
     }
-
   }
 
+  /** \return Transmission instance. */
+  Transmission* getTransmission() const {return transmission_;}
+
+  /** \return Actuator-space variables. */
+  const ActuatorData& getActuatorData() const {return actuator_data_;}
+
+  /** \return Joint-space variables. */
+  const JointData& getJointData() const {return joint_data_;}
+
 private:
+  friend class TransmissionHandle; // Maps take non-const references to the output data
+
+  Transmission* transmission_;
+  ActuatorData  actuator_data_;
+  JointData     joint_data_;
+
   static bool hasValidPointers(const std::vector<double*>& data)
   {
     for (std::vector<double*>::const_iterator it = data.begin(); it != data.end(); ++it)
@@ -188,6 +197,75 @@ private:
   }
 };
 
+typedef boost::shared_ptr<ValidatedTransmissionData> ValidatedTransmissionDataPtr;
+
+/**
+ * \brief Handle for propagating a single map (position, velocity, or effort) on a single transmission
+ * (eg. actuator to joint effort for a simple reducer).
+ */
+class TransmissionHandle
+{
+public:
+  /** \return Transmission name. */
+  std::string getName() const {return name_;}
+
+  /** \return Transmission instance whose map is propagated by this handle. */
+  Transmission* getTransmission() const {return transmission_;}
+
+  /** \return Actuator-space variables of this handle. */
+  const ActuatorData& getActuatorData() const {return data_->getActuatorData();}
+
+  /** \return Joint-space variables of this handle. */
+  const JointData& getJointData() const {return data_->getJointData();}
+
+  /** \return Validated data of this handle, which can be shared with other handles of the same transmission. */
+  const ValidatedTransmissionDataPtr& getData() const {return data_;}
+
+protected:
+  std::string               name_;
+  Transmission*             transmission_;
+  ValidatedTransmissionDataPtr data_;
+
+  /**
+   * \param name %Transmission name.
+   * \param transmission Pointer to transmission instance.
+   * \param actuator_data Actuator-space variables.
+   * \param joint_data Joint-space variables.
+   * \note The lifecycle of the pointed-to instances passed as parameters is not handled by this class.
+   * \pre Valid transmission pointer. Actuator and joint variable vectors required by this handle must contain valid
+   * data and their size should be consistent with the number of transmission actuators and joints.
+   * Data vectors not used by this handle can remain empty.
+   * \sa ValidatedTransmissionData
+   */
+  TransmissionHandle(const std::string&  name,
+                     Transmission*       transmission,
+                     const ActuatorData& actuator_data,
+                     const JointData&    joint_data)
+    : name_(name),
+      transmission_(transmission),
+      data_(boost::make_shared<ValidatedTransmissionData>(transmission, actuator_data, joint_data))
+  {}
+
+  /**
+   * \brief Create a handle from already validated data, which is shared instead of copied.
+   * \param name %Transmission name.
+   * \param data Validated transmission data. An exception is thrown if it is null.
+   */
+  TransmissionHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : name_(name),
+      transmission_(data ? data->getTransmission() : 0),
+      data_(data)
+  {
+    if (!data_) {throw TransmissionInterfaceException("Unspecified transmission data.");}
+  }
+
+  /** \return Actuator-space variables, for passing them to transmission maps. */
+  ActuatorData& actuatorData() const {return data_->actuator_data_;}
+
+  /** \return Joint-space variables, for passing them to transmission maps. */
+  JointData& jointData() const {return data_->joint_data_;}
+};
+
 /**
  *\brief Handle for propagating actuator state (position, velocity and effort) to joint state for a given transmission.
  */
@@ -201,23 +279,14 @@ public:
                              const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  ActuatorToJointStateHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate actuator state to joint state for the stored transmission. */
-  void propagate()
-  {
-    transmission_->actuatorToJointPosition(actuator_data_, joint_data_);
-    transmission_->actuatorToJointVelocity(actuator_data_, joint_data_);
-    transmission_->actuatorToJointEffort(actuator_data_, joint_data_);
-
-    if(!actuator_data_.absolute_position.empty() && transmission_->hasActuatorToJointAbsolutePosition()){
-       transmission_->actuatorToJointAbsolutePosition(actuator_data_, joint_data_);
-    }
-
-    if(!actuator_data_.torque_sensor.empty() && transmission_->hasActuatorToJointTorqueSensor()){
-       transmission_->actuatorToJointTorqueSensor(actuator_data_, joint_data_);
-    }
-  }
+  void propagate() {transmission_->actuatorToJointState(actuatorData(), jointData());}
   /*\}*/
 };
 
@@ -233,10 +302,14 @@ public:
                                 const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  ActuatorToJointPositionHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate actuator positions to joint positions for the stored transmission. */
-  void propagate() {transmission_->actuatorToJointPosition(actuator_data_, joint_data_);}
+  void propagate() {transmission_->actuatorToJointPosition(actuatorData(), jointData());}
   /*\}*/
 };
 
@@ -252,10 +325,14 @@ public:
                                 const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  ActuatorToJointVelocityHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate actuator velocities to joint velocities for the stored transmission. */
-  void propagate() {transmission_->actuatorToJointVelocity(actuator_data_, joint_data_);}
+  void propagate() {transmission_->actuatorToJointVelocity(actuatorData(), jointData());}
   /*\}*/
 };
 
@@ -271,10 +348,14 @@ public:
                               const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  ActuatorToJointEffortHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate actuator efforts to joint efforts for the stored transmission. */
-  void propagate() {transmission_->actuatorToJointEffort(actuator_data_, joint_data_);}
+  void propagate() {transmission_->actuatorToJointEffort(actuatorData(), jointData());}
   /*\}*/
 };
 
@@ -292,14 +373,18 @@ public:
                              const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  JointToActuatorStateHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate joint state to actuator state for the stored transmission. */
   void propagate()
   {
-    transmission_->jointToActuatorPosition(joint_data_, actuator_data_);
-    transmission_->jointToActuatorVelocity(joint_data_, actuator_data_);
-    transmission_->jointToActuatorEffort(  joint_data_, actuator_data_);
+    transmission_->jointToActuatorPosition(jointData(), actuatorData());
+    transmission_->jointToActuatorVelocity(jointData(), actuatorData());
+    transmission_->jointToActuatorEffort(  jointData(), actuatorData());
   }
   /*\}*/
 };
@@ -316,10 +401,14 @@ public:
                                 const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  JointToActuatorPositionHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate joint positions to actuator positions for the stored transmission. */
-  void propagate() {transmission_->jointToActuatorPosition(joint_data_, actuator_data_);}
+  void propagate() {transmission_->jointToActuatorPosition(jointData(), actuatorData());}
   /*\}*/
 };
 
@@ -335,10 +424,14 @@ public:
                                 const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  JointToActuatorVelocityHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate joint velocities to actuator velocities for the stored transmission. */
-  void propagate() {transmission_->jointToActuatorVelocity(joint_data_, actuator_data_);}
+  void propagate() {transmission_->jointToActuatorVelocity(jointData(), actuatorData());}
   /*\}*/
 };
 
@@ -354,13 +447,82 @@ public:
                               const JointData&    joint_data)
     : TransmissionHandle(name, transmission, actuator_data, joint_data) {}
 
+  /** \sa TransmissionHandle::TransmissionHandle */
+  JointToActuatorEffortHandle(const std::string& name, const ValidatedTransmissionDataPtr& data)
+    : TransmissionHandle(name, data) {}
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate joint efforts to actuator efforts for the stored transmission. */
-  void propagate() {transmission_->jointToActuatorEffort(joint_data_, actuator_data_);}
+  void propagate() {transmission_->jointToActuatorEffort(jointData(), actuatorData());}
   /*\}*/
 };
 
+/** \cond HIDDEN_SYMBOLS */
+namespace internal
+{
+
+inline void appendDataPointers(const std::vector<double*>& data, std::vector<const double*>& out)
+{
+  out.insert(out.end(), data.begin(), data.end());
+}
+
+// Raw data accessed by a transmission handle. Returns false if the handle type does not expose its data
+inline bool getDataPointers(const TransmissionHandle& handle, std::vector<const double*>& out)
+{
+  const ActuatorData& act_data = handle.getActuatorData();
+  const JointData&    jnt_data = handle.getJointData();
+  appendDataPointers(act_data.position,          out);
+  appendDataPointers(act_data.velocity,          out);
+  appendDataPointers(act_data.effort,            out);
+  appendDataPointers(act_data.absolute_position, out);
+  appendDataPointers(act_data.torque_sensor,     out);
+  appendDataPointers(jnt_data.position,          out);
+  appendDataPointers(jnt_data.velocity,          out);
+  appendDataPointers(jnt_data.effort,            out);
+  appendDataPointers(jnt_data.absolute_position, out);
+  appendDataPointers(jnt_data.torque_sensor,     out);
+  return true;
+}
+
+template <class HandleType>
+bool getDataPointers(const HandleType& handle, std::vector<const double*>& out, boost::true_type)
+{
+  return getDataPointers(static_cast<const TransmissionHandle&>(handle), out);
+}
+
+template <class HandleType>
+bool getDataPointers(const HandleType&, std::vector<const double*>&, boost::false_type)
+{
+  return false;
+}
+
+} // namespace
+/** \endcond */
+
+/**
+ * \brief Strategy for propagating the handles of a \ref TransmissionInterface other than one by one, eg. in parallel.
+ * \sa TransmissionInterface::setPropagator
+ */
+template <class HandleType>
+class HandlePropagator
+{
+public:
+  virtual ~HandlePropagator() {}
+
+  /**
+   * \brief Prepare for propagating a set of handles. Not realtime-safe.
+   *
+   * Called when the propagator is attached to an interface, and whenever handles are registered to it.
+   * \param handles Handles of the interface, in serial propagation order. Propagators keep copies of the handles they
+   * need, which is cheap since handles only refer to the transmission and its data.
+   */
+  virtual void setHandles(const std::vector<HandleType>& handles) = 0;
+
+  /** \brief Propagate the handles passed to the last call to \ref setHandles. Must be realtime-safe. */
+  virtual void propagate() = 0;
+};
+
 /**
  * \brief Interface for propagating a given map on a set of transmissions.
  *
@@ -371,6 +533,9 @@ public:
  * The set of transmissions handled by this interface can be heterogeneous, (eg. an arm with a four-bar-linkage in the
  * shoulder, a differential in the wrist, and simple reducers elsewhere).
  *
+ * Handles are propagated one by one, sorted by name, unless a \ref HandlePropagator is attached to the interface
+ * with \ref setPropagator, eg. a \ref ParallelPropagator.
+ *
  * \tparam HandleType %Transmission handle type. Must implement the following methods:
  *  \code
  *   void propagate();
@@ -382,6 +547,23 @@ template <class HandleType>
 class TransmissionInterface : public hardware_interface::ResourceManager<HandleType>
 {
 public:
+  TransmissionInterface() {}
+
+  /** \brief Copy the handles of \e other. The copy propagates handles one by one, see \ref setPropagator. */
+  TransmissionInterface(const TransmissionInterface& other)
+    : hardware_interface::ResourceManager<HandleType>(other)
+  {
+    rebuildHandles();
+  }
+
+  /** \sa TransmissionInterface(const TransmissionInterface&) */
+  TransmissionInterface& operator=(const TransmissionInterface& other)
+  {
+    hardware_interface::ResourceManager<HandleType>::operator=(other);
+    propagator_.reset();
+    rebuildHandles();
+    return *this;
+  }
 
   HandleType getHandle(const std::string& name)
   {
@@ -396,18 +578,88 @@ public:
     }
   }
 
+  /** \name Non Real-Time Safe Functions
+   *\{*/
+
+  /**
+   * \brief Attach a strategy for propagating the managed handles.
+   *
+   * A propagator keeps pointers to the handles of a single interface, so it must not be attached to several
+   * interfaces, and copies of this interface don't share it.
+   * \param propagator Handle propagator. Passing a null pointer restores propagating handles one by one.
+   */
+  void setPropagator(const boost::shared_ptr<HandlePropagator<HandleType> >& propagator)
+  {
+    propagator_ = propagator;
+    if (propagator_) {propagator_->setHandles(handles_);}
+  }
+
+  /** \return Attached handle propagator, if any. */
+  const boost::shared_ptr<HandlePropagator<HandleType> >& getPropagator() const {return propagator_;}
+
+  /*\}*/
+
   /** \name Real-Time Safe Functions
    *\{*/
   /** \brief Propagate the transmission maps of all managed handles. */
   void propagate()
   {
-    typedef typename hardware_interface::ResourceManager<HandleType>::ResourceMap::iterator ItratorType;
-    for (ItratorType it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    if (propagator_)
+    {
+      propagator_->propagate();
+      return;
+    }
+
+    typedef typename std::vector<HandleType>::iterator IteratorType;
+    for (IteratorType it = handles_.begin(); it != handles_.end(); ++it)
     {
-      it->second.propagate();
+      it->propagate();
     }
   }
   /*\}*/
+
+protected:
+  typedef typename hardware_interface::ResourceManager<HandleType>::ResourceMap ResourceMap;
+
+  /** \brief Add a new handle to the sequence of handles iterated by \ref propagate. */
+  virtual void onResourceAdded(typename ResourceMap::iterator it)
+  {
+    // Handles are kept in map order, ie. sorted by name, so the position of the new handle is found by bisection
+    handles_.insert(std::lower_bound(handles_.begin(), handles_.end(), it->first, HandleNameLess()), it->second);
+    if (propagator_) {propagator_->setHandles(handles_);}
+  }
+
+  /** \brief Update the sequence of handles iterated by \ref propagate, and the attached propagator. */
+  virtual void onResourceReplaced()
+  {
+    rebuildHandles();
+    if (propagator_) {propagator_->setHandles(handles_);}
+  }
+
+private:
+  /**
+   * Copies of the handles stored in the resource map, in map order. Propagating maps iterates this contiguous array
+   * instead of walking the map nodes, which is only used for looking up handles by name.
+   */
+  std::vector<HandleType> handles_;
+
+  boost::shared_ptr<HandlePropagator<HandleType> > propagator_;
+
+  struct HandleNameLess
+  {
+    bool operator()(const HandleType& handle, const std::string& name) const {return handle.getName() < name;}
+  };
+
+  /** \brief Rebuild the sequence of handles iterated by \ref propagate. */
+  void rebuildHandles()
+  {
+    handles_.clear();
+    handles_.reserve(this->resource_map_.size());
+    for (typename ResourceMap::iterator it = this->resource_map_.begin(); it != this->resource_map_.end(); ++it)
+    {
+      handles_.push_back(it->second);
+    }
+  }
 };
 
 // Convenience typedefs
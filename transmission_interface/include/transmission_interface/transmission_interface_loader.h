@@ -32,6 +32,7 @@
 
 // C++ standard
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <map>
 #include <string>
@@ -51,15 +52,18 @@
 // ros_control
 #include <hardware_interface/actuator_state_interface.h>
 #include <hardware_interface/actuator_command_interface.h>
+#include <hardware_interface/internal/aligned_arrays.h>
 #include <hardware_interface/internal/demangle_symbol.h>
 #include <hardware_interface/joint_state_interface.h>
 #include <hardware_interface/joint_command_interface.h>
 #include <hardware_interface/robot_hw.h>
 
+#include <transmission_interface/propagation_worker_pool.h>
 #include <transmission_interface/robot_transmissions.h>
 #include <transmission_interface/transmission.h>
 #include <transmission_interface/transmission_interface.h>
 #include <transmission_interface/transmission_info.h>
+#include <transmission_interface/transmission_info_cache.h>
 #include <transmission_interface/transmission_loader.h>
 #include <transmission_interface/transmission_parser.h>
 
@@ -99,42 +103,150 @@ bool is_permutation(ForwardIt1 first, ForwardIt1 last,
 
 
 /**
- * \brief Raw data for a set of joints.
+ * \brief Raw data of a single joint.
  *
  * For simplicity, every joint has read/write position, velocity and effort variables, but not all of them will
- * necessarily be used.
+ * necessarily be used. Variables are not stored in this structure, but point to the storage of the
+ * \ref RawJointDataMap instance that owns them.
  */
 // TODO: Don't assume interfaces?
 struct RawJointData
 {
   RawJointData()
-    : position(std::numeric_limits<double>::quiet_NaN()),
-      velocity(std::numeric_limits<double>::quiet_NaN()),
-      effort(std::numeric_limits<double>::quiet_NaN()),
-      position_cmd(std::numeric_limits<double>::quiet_NaN()),
-      velocity_cmd(std::numeric_limits<double>::quiet_NaN()),
-      effort_cmd(std::numeric_limits<double>::quiet_NaN()),
-      absolute_position(std::numeric_limits<double>::quiet_NaN()),
-      torque_sensor(std::numeric_limits<double>::quiet_NaN()),
+    : position(0),
+      velocity(0),
+      effort(0),
+      position_cmd(0),
+      velocity_cmd(0),
+      effort_cmd(0),
+      absolute_position(0),
+      torque_sensor(0),
       hasAbsolutePosition(true),
       hasTorqueSensor(true)
   {}
 
-  double position;
-  double velocity;
-  double effort;
-  double position_cmd;
-  double velocity_cmd;
-  double effort_cmd;
+  double* position;
+  double* velocity;
+  double* effort;
+  double* position_cmd;
+  double* velocity_cmd;
+  double* effort_cmd;
 
-  double absolute_position;
-  double torque_sensor;
+  double* absolute_position;
+  double* torque_sensor;
 
   bool hasAbsolutePosition;
   bool hasTorqueSensor;
 };
 
-typedef std::map<std::string, RawJointData> RawJointDataMap;
+/**
+ * \brief Raw data for a set of joints, indexed by joint name.
+ *
+ * Joint variables are stored in a structure of arrays layout, one cache-aligned array per variable, so that
+ * propagating transmissions of many joints walks contiguous memory instead of individually allocated nodes.
+ * Storage is allocated in blocks that are never reallocated, hence the addresses of joint variables remain valid for
+ * the whole lifetime of the instance. Calling \ref reserve when the number of joints is known beforehand (eg. after
+ * parsing a robot description) keeps the data of all of them in a single block.
+ *
+ * Joint variables are initialized to NaN.
+ */
+class RawJointDataMap
+{
+public:
+  typedef std::map<std::string, RawJointData> Index;
+  typedef Index::const_iterator               const_iterator;
+
+  RawJointDataMap()
+    : block_size_(0),
+      block_capacity_(0)
+  {}
+
+  /** \return Number of joints in the map. */
+  std::size_t size() const {return index_.size();}
+
+  /** \return True if the map contains no joints. */
+  bool empty() const {return index_.empty();}
+
+  /** \return Number of joints that can be added before a new storage block needs to be allocated. */
+  std::size_t available() const {return block_capacity_ - block_size_;}
+
+  /**
+   * \brief Ensure that \p n new joints can be added to the map in a single contiguous block.
+   *
+   * If the current block does not have enough room, a new block is allocated and the remaining room of the current
+   * one is left unused. Data of existing joints is not moved.
+   */
+  void reserve(std::size_t n)
+  {
+    if (available() < n) {addBlock(n);}
+  }
+
+  const_iterator begin() const {return index_.begin();}
+  const_iterator end()   const {return index_.end();}
+  const_iterator find(const std::string& name) const {return index_.find(name);}
+  std::size_t    count(const std::string& name) const {return index_.count(name);}
+
+  /**
+   * \param name Joint name.
+   * \return Raw data of the joint. The joint is added to the map if it does not yet exist.
+   */
+  RawJointData& operator[](const std::string& name)
+  {
+    Index::iterator it = index_.lower_bound(name);
+    if (it != index_.end() && it->first == name) {return it->second;}
+
+    if (0 == available()) {addBlock(size() > MIN_BLOCK_SIZE ? size() : MIN_BLOCK_SIZE);}
+    hardware_interface::internal::AlignedArrays& block = *blocks_.back();
+    const std::size_t i = block_size_++;
+
+    RawJointData data;
+    data.position          = block.data(POSITION)          + i;
+    data.velocity          = block.data(VELOCITY)          + i;
+    data.effort            = block.data(EFFORT)            + i;
+    data.position_cmd      = block.data(POSITION_CMD)      + i;
+    data.velocity_cmd      = block.data(VELOCITY_CMD)      + i;
+    data.effort_cmd        = block.data(EFFORT_CMD)        + i;
+    data.absolute_position = block.data(ABSOLUTE_POSITION) + i;
+    data.torque_sensor     = block.data(TORQUE_SENSOR)     + i;
+    return index_.insert(it, std::make_pair(name, data))->second;
+  }
+
+private:
+  enum Field
+  {
+    POSITION = 0,
+    VELOCITY,
+    EFFORT,
+    POSITION_CMD,
+    VELOCITY_CMD,
+    EFFORT_CMD,
+    ABSOLUTE_POSITION,
+    TORQUE_SENSOR,
+    NUM_FIELDS
+  };
+
+  /// Smallest block allocated when joints are added without a prior call to \ref reserve.
+  static const std::size_t MIN_BLOCK_SIZE = 16;
+
+  typedef boost::shared_ptr<hardware_interface::internal::AlignedArrays> BlockPtr;
+
+  Index                 index_;
+  std::vector<BlockPtr> blocks_;
+  std::size_t           block_size_;     ///< Number of joints stored in the last block
+  std::size_t           block_capacity_; ///< Number of joints that fit in the last block
+
+  void addBlock(std::size_t capacity)
+  {
+    blocks_.push_back(BlockPtr(new hardware_interface::internal::AlignedArrays(
+                                   NUM_FIELDS, capacity, std::numeric_limits<double>::quiet_NaN())));
+    block_size_     = 0;
+    block_capacity_ = capacity;
+  }
+
+  // Copies would point to the storage of the original instance
+  RawJointDataMap(const RawJointDataMap&);
+  RawJointDataMap& operator=(const RawJointDataMap&);
+};
 
 /**
  * \brief Joint interfaces of a robot. Only used interfaces need to be populated.
@@ -210,6 +322,11 @@ protected:
     JointData       jnt_state_data;
     JointData       jnt_cmd_data;
     TransmissionPtr transmission;
+
+    /** State and command data, validated once for all the handles of the transmission. Command data is null if the
+     *  provider has no command data. */
+    ValidatedTransmissionDataPtr state_data;
+    ValidatedTransmissionDataPtr cmd_data;
   };
 
   virtual bool getJointStateData(const TransmissionInfo& transmission_info,
@@ -237,8 +354,7 @@ protected:
     using hardware_interface::internal::demangledTypeName;
 
     // Do nothing if resource already exists on the interface
-    const std::vector<std::string>& existing_resources = iface.getNames();
-    if (existing_resources.end() != std::find(existing_resources.begin(), existing_resources.end(), name))
+    if (iface.hasHandle(name))
     {
       ROS_DEBUG_STREAM_NAMED("parser", "Resource '" << name << "' already exists on interface '" <<
                              demangledTypeName<Interface>());
@@ -403,6 +519,28 @@ public:
    */
   bool load(const TransmissionInfo& transmission_info);
 
+  /**
+   * \brief Enable or disable concurrent construction of transmissions.
+   *
+   * When enabled, \ref load(const std::vector<TransmissionInfo>&) works in two phases: transmission instances are
+   * first constructed concurrently by the threads of \p pool, and are then registered serially into the joint and
+   * transmission interfaces, in the same order as in serial loading. Results, including which transmissions are
+   * loaded when one of them fails, are identical to those of serial loading.
+   * \param pool Worker pool, which must remain valid while loading. Passing a null pointer disables concurrent
+   * construction.
+   * \note Transmission loader plugins must be safe to call concurrently, which is the case of those of this package.
+   */
+  void setParallelLoading(PropagationWorkerPool* pool) {load_pool_ = pool;}
+
+  /**
+   * \brief Set the path of a cache of the transmissions parsed by \ref load(const std::string&).
+   *
+   * When set, transmissions are read from the cache file if it was built from the same robot description, which is
+   * much faster than parsing it. Otherwise the robot description is parsed, and the cache file is (re)written.
+   * \param path Cache file path. An empty path disables caching.
+   */
+  void setCacheFile(const std::string& path) {cache_path_ = path;}
+
   TransmissionLoaderData* getData() {return &loader_data_;}
 
 private:
@@ -415,9 +553,56 @@ private:
   typedef boost::shared_ptr<TransmissionLoader>           TransmissionLoaderPtr;
   typedef boost::shared_ptr<RequisiteProvider>            RequisiteProviderPtr;
 
+  typedef std::map<std::string, TransmissionLoaderPtr>   TransmissionLoaderMap;
+  typedef std::map<std::string, RequisiteProviderPtr>    RequisiteProviderMap;
+
   TransmissionClassLoaderPtr transmission_class_loader_;
   RequisiteProviderClassLoaderPtr req_provider_loader_;
 
+  // Plugin instances are stateless, so a single instance per type is shared by all transmissions
+  TransmissionLoaderMap transmission_loaders_;
+  RequisiteProviderMap  req_providers_;
+
+  /**
+   * \return Transmission loader plugin for transmissions of type \p type. It is instantiated on first use, and
+   * reused afterwards.
+   * \throws pluginlib::LibraryLoadException if no plugin is available for \p type.
+   */
+  TransmissionLoaderPtr getTransmissionLoader(const std::string& type);
+
+  /**
+   * \return Requisite provider plugin for the \p hw_iface hardware interface. It is instantiated on first use, and
+   * reused afterwards.
+   * \throws pluginlib::LibraryLoadException if no plugin is available for \p hw_iface.
+   */
+  RequisiteProviderPtr getRequisiteProvider(const std::string& hw_iface);
+
+  /** \brief Construction of a single transmission, as performed by a thread of \ref load_pool_. */
+  struct TransmissionConstruction
+  {
+    const TransmissionInfo* info;
+    TransmissionLoaderPtr   loader;
+    TransmissionPtr         transmission;
+    std::exception_ptr      error; ///< Exception thrown by \c loader, rethrown when registering the transmission
+  };
+
+  static void constructTransmission(void* context, std::size_t i);
+
+  /**
+   * \brief Construct a transmission instance.
+   * \return The new instance, or a null pointer if construction fails.
+   */
+  TransmissionPtr createTransmission(const TransmissionInfo& transmission_info);
+
+  /** \brief Register a transmission into the joint and transmission interfaces. */
+  bool registerTransmission(const TransmissionInfo& transmission_info, TransmissionPtr transmission);
+
+  /** \brief Log the failure of constructing a transmission of unsupported type. */
+  static void logUnsupportedType(const TransmissionInfo& transmission_info, const pluginlib::LibraryLoadException& ex);
+
+  PropagationWorkerPool* load_pool_;
+  std::string            cache_path_;
+
 private:
   hardware_interface::RobotHW* robot_hw_ptr_;
   RobotTransmissions*          robot_transmissions_ptr_;
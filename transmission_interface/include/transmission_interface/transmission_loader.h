@@ -71,6 +71,8 @@ public:
   virtual TransmissionPtr load(const TransmissionInfo& transmission_info) = 0;
 
 protected:
+  typedef boost::shared_ptr<const TiXmlElement> XmlElementConstPtr;
+
   enum ParseStatus
   {
     SUCCESS,
@@ -113,6 +115,35 @@ protected:
     return element;
   }
 
+  /**
+   * \return XML element of a joint. The element pre-parsed by \ref TransmissionParser is shared if available,
+   * otherwise it is parsed from its string representation.
+   */
+  static XmlElementConstPtr loadXmlElement(const JointInfo& joint_info)
+  {
+    return loadXmlElement(joint_info.xml_element_ptr_, joint_info.xml_element_);
+  }
+
+  /**
+   * \return XML element of an actuator. The element pre-parsed by \ref TransmissionParser is shared if available,
+   * otherwise it is parsed from its string representation.
+   */
+  static XmlElementConstPtr loadXmlElement(const ActuatorInfo& actuator_info)
+  {
+    return loadXmlElement(actuator_info.xml_element_ptr_, actuator_info.xml_element_);
+  }
+
+  static XmlElementConstPtr loadXmlElement(const XmlElementConstPtr& element, const std::string& element_str)
+  {
+    if (element) {return element;}
+
+    boost::shared_ptr<TiXmlElement> parsed_element(new TiXmlElement(""));
+    std::stringstream element_stream;
+    element_stream << element_str;
+    element_stream >> *parsed_element;
+    return parsed_element;
+  }
+
   static ParseStatus getActuatorReduction(const TiXmlElement& parent_el,
                                           const std::string&  actuator_name,
                                           const std::string&  transmission_name,
@@ -42,6 +42,15 @@
 #ifndef TRANSMISSION_INTERFACE_TRANSMISSION_PARSER_H
 #define TRANSMISSION_INTERFACE_TRANSMISSION_PARSER_H
 
+// C++ standard
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Boost
+#include <boost/shared_ptr.hpp>
+
 // ros_control
 #include <transmission_interface/transmission_info.h>
 
@@ -54,7 +63,15 @@
 namespace transmission_interface
 {
 
-/** \brief Parse all transmissions specified in a URDF. */
+/**
+ * \brief Parse all transmissions specified in a URDF.
+ *
+ * Robot descriptions are scanned for <tt>\<transmission\></tt> elements without building a DOM of the whole document,
+ * so large descriptions (eg. with inlined meshes) are cheap to parse. Only transmission elements are parsed with
+ * TinyXML, and the parsed joint and actuator elements are handed to transmission loaders through
+ * \ref JointInfo::xml_element_ptr_ and \ref ActuatorInfo::xml_element_ptr_. Their string representations are then not
+ * built, see \ref getXmlElementString.
+ */
 class TransmissionParser
 {
 public:
@@ -68,21 +85,42 @@ public:
   static bool parse(const std::string& urdf_string, std::vector<TransmissionInfo>& transmissions);
 
 protected:
+  typedef boost::shared_ptr<TiXmlDocument>    XmlDocumentPtr;
+  typedef std::pair<std::size_t, std::size_t> XmlRange; ///< Position and length of an element in a document
+  typedef std::vector<XmlRange>               XmlRanges;
+
+  /**
+   * \brief Locates the <tt>\<transmission\></tt> elements that are children of the root element of an XML document.
+   *
+   * The document is scanned without building a DOM, but checking that it is well-formed: elements must be properly
+   * nested, and comments, CDATA sections, processing instructions and attribute values must be terminated.
+   * \param[in] xml XML document.
+   * \param[out] transmissions Position and length of each <tt>\<transmission\></tt> element of \p xml.
+   * \return true if \p xml is a well-formed document.
+   */
+  static bool findTransmissions(const std::string& xml, XmlRanges& transmissions);
+
   /**
    * \brief Parses the joint elements within tranmission elements of a URDF
    * \param[in] trans_it pointer to the current XML element being parsed
    * \param[out] joints resulting list of joints in the transmission
+   * \param[in] doc document owning \p trans_it. If set, parsed joint elements are exposed through
+   * \ref JointInfo::xml_element_ptr_, otherwise they are stored as strings in \ref JointInfo::xml_element_.
    * \return true if successful
    */
-  static bool parseJoints(TiXmlElement *trans_it, std::vector<JointInfo>& joints);
+  static bool parseJoints(TiXmlElement *trans_it, std::vector<JointInfo>& joints,
+                          const XmlDocumentPtr& doc = XmlDocumentPtr());
 
   /**
    * \brief Parses the actuator elements within tranmission elements of a URDF
    * \param[in] trans_it pointer to the current XML element being parsed
    * \param[out] actuators resulting list of actuators in the transmission
+   * \param[in] doc document owning \p trans_it. If set, parsed actuator elements are exposed through
+   * \ref ActuatorInfo::xml_element_ptr_, otherwise they are stored as strings in \ref ActuatorInfo::xml_element_.
    * \return true if successful
    */
-  static bool parseActuators(TiXmlElement *trans_it, std::vector<ActuatorInfo>& actuators);
+  static bool parseActuators(TiXmlElement *trans_it, std::vector<ActuatorInfo>& actuators,
+                             const XmlDocumentPtr& doc = XmlDocumentPtr());
 
 }; // class
 
@@ -85,9 +85,9 @@ bool DifferentialTransmissionLoader::getActuatorConfig(const TransmissionInfo& t
   const std::string ACTUATOR1_ROLE = "actuator1";
   const std::string ACTUATOR2_ROLE = "actuator2";
 
-  std::vector<TiXmlElement> act_elements(2,"");
-  std::vector<std::string>  act_names(2);
-  std::vector<std::string>  act_roles(2);
+  std::vector<XmlElementConstPtr> act_elements(2);
+  std::vector<std::string>        act_names(2);
+  std::vector<std::string>        act_roles(2);
 
   for (unsigned int i = 0; i < 2; ++i)
   {
@@ -95,11 +95,11 @@ bool DifferentialTransmissionLoader::getActuatorConfig(const TransmissionInfo& t
     act_names[i] = transmission_info.actuators_[i].name_;
 
     // Actuator xml element
-    act_elements[i] = loadXmlElement(transmission_info.actuators_[i].xml_element_);
+    act_elements[i] = loadXmlElement(transmission_info.actuators_[i]);
 
     // Populate role string
     std::string& act_role = act_roles[i];
-    const ParseStatus act_role_status = getActuatorRole(act_elements[i],
+    const ParseStatus act_role_status = getActuatorRole(*act_elements[i],
                                                         act_names[i],
                                                         transmission_info.name_,
                                                         true, // Required
@@ -144,7 +144,7 @@ bool DifferentialTransmissionLoader::getActuatorConfig(const TransmissionInfo& t
   for (unsigned int i = 0; i < 2; ++i)
   {
     const unsigned int id = id_map[i];
-    const ParseStatus reduction_status = getActuatorReduction(act_elements[id],
+    const ParseStatus reduction_status = getActuatorReduction(*act_elements[id],
                                                               act_names[id],
                                                               transmission_info.name_,
                                                               true, // Required
@@ -163,9 +163,9 @@ bool DifferentialTransmissionLoader::getJointConfig(const TransmissionInfo& tran
   const std::string JOINT1_ROLE = "joint1";
   const std::string JOINT2_ROLE = "joint2";
 
-  std::vector<TiXmlElement> jnt_elements(2,"");
-  std::vector<std::string>  jnt_names(2);
-  std::vector<std::string>  jnt_roles(2);
+  std::vector<XmlElementConstPtr> jnt_elements(2);
+  std::vector<std::string>        jnt_names(2);
+  std::vector<std::string>        jnt_roles(2);
 
   for (unsigned int i = 0; i < 2; ++i)
   {
@@ -173,11 +173,11 @@ bool DifferentialTransmissionLoader::getJointConfig(const TransmissionInfo& tran
     jnt_names[i] = transmission_info.joints_[i].name_;
 
     // Joint xml element
-    jnt_elements[i] = loadXmlElement(transmission_info.joints_[i].xml_element_);
+    jnt_elements[i] = loadXmlElement(transmission_info.joints_[i]);
 
     // Populate role string
     std::string& jnt_role = jnt_roles[i];
-    const ParseStatus jnt_role_status = getJointRole(jnt_elements[i],
+    const ParseStatus jnt_role_status = getJointRole(*jnt_elements[i],
                                                      jnt_names[i],
                                                      transmission_info.name_,
                                                      true, // Required
@@ -226,7 +226,7 @@ bool DifferentialTransmissionLoader::getJointConfig(const TransmissionInfo& tran
 
     // Parse optional mechanical reductions. Even though it's optional --and to avoid surprises-- we fail if the element
     // is specified but is of the wrong type
-    const ParseStatus reduction_status = getJointReduction(jnt_elements[id],
+    const ParseStatus reduction_status = getJointReduction(*jnt_elements[id],
                                                            jnt_names[id],
                                                            transmission_info.name_,
                                                            false, // Optional
@@ -235,7 +235,7 @@ bool DifferentialTransmissionLoader::getJointConfig(const TransmissionInfo& tran
 
     // Parse optional joint offset. Even though it's optional --and to avoid surprises-- we fail if the element is
     // specified but is of the wrong type
-    const ParseStatus offset_status = getJointOffset(jnt_elements[id],
+    const ParseStatus offset_status = getJointOffset(*jnt_elements[id],
                                                      jnt_names[id],
                                                      transmission_info.name_,
                                                      false, // Optional
@@ -246,7 +246,7 @@ bool DifferentialTransmissionLoader::getJointConfig(const TransmissionInfo& tran
   // Parse if transmision has to be ignored for absolute encoders
   ignore_transmission_for_absolute_encoders = true;
   for (unsigned int i = 0; i < 2; ++i){
-    const TiXmlElement* role_el = jnt_elements[i].FirstChildElement("ignoreTransmissionAbsoluteEncoder");
+    const TiXmlElement* role_el = jnt_elements[i]->FirstChildElement("ignoreTransmissionAbsoluteEncoder");
     bool ignore = false;
     if(role_el){
       ignore = true;
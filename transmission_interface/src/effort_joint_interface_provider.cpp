@@ -66,7 +66,7 @@ bool EffortJointInterfaceProvider::updateJointInterfaces(const TransmissionInfo&
     using hardware_interface::JointHandle;
     RawJointData& raw_joint_data = raw_joint_data_map[name];
     JointHandle handle(joint_interfaces.joint_state_interface.getHandle(joint_info.name_),
-                       &raw_joint_data.effort_cmd);
+                       raw_joint_data.effort_cmd);
     interface.registerHandle(handle);
   }
   return true;
@@ -86,8 +86,7 @@ bool EffortJointInterfaceProvider::getJointCommandData(const TransmissionInfo& t
     if (raw_joint_data_it == raw_joint_data_map.end()) {return false;} // Joint name not found!
     const RawJointData& raw_joint_data = raw_joint_data_it->second;
 
-    // TODO: Get rid of these const casts!
-    jnt_cmd_data.effort[i] = const_cast<double*>(&(raw_joint_data.effort_cmd));
+    jnt_cmd_data.effort[i] = raw_joint_data.effort_cmd;
   }
 
   return true;
@@ -135,10 +134,7 @@ bool EffortJointInterfaceProvider::registerTransmission(TransmissionLoaderData&
   JointToActuatorEffortInterface& interface = *(loader_data.robot_transmissions->get<JointToActuatorEffortInterface>());
 
   // Setup command interface
-  JointToActuatorEffortHandle handle(handle_data.name,
-                                     handle_data.transmission.get(),
-                                     handle_data.act_cmd_data,
-                                     handle_data.jnt_cmd_data);
+  JointToActuatorEffortHandle handle(handle_data.name, handle_data.cmd_data);
   interface.registerHandle(handle);
   return true;
 }
@@ -82,9 +82,9 @@ bool FourBarLinkageTransmissionLoader::getActuatorConfig(const TransmissionInfo&
   const std::string ACTUATOR1_ROLE = "actuator1";
   const std::string ACTUATOR2_ROLE = "actuator2";
 
-  std::vector<TiXmlElement> act_elements(2,"");
-  std::vector<std::string>  act_names(2);
-  std::vector<std::string>  act_roles(2);
+  std::vector<XmlElementConstPtr> act_elements(2);
+  std::vector<std::string>        act_names(2);
+  std::vector<std::string>        act_roles(2);
 
   for (unsigned int i = 0; i < 2; ++i)
   {
@@ -92,11 +92,11 @@ bool FourBarLinkageTransmissionLoader::getActuatorConfig(const TransmissionInfo&
     act_names[i] = transmission_info.actuators_[i].name_;
 
     // Actuator xml element
-    act_elements[i] = loadXmlElement(transmission_info.actuators_[i].xml_element_);
+    act_elements[i] = loadXmlElement(transmission_info.actuators_[i]);
 
     // Populate role string
     std::string& act_role = act_roles[i];
-    const ParseStatus act_role_status = getActuatorRole(act_elements[i],
+    const ParseStatus act_role_status = getActuatorRole(*act_elements[i],
                                                         act_names[i],
                                                         transmission_info.name_,
                                                         true, // Required
@@ -141,7 +141,7 @@ bool FourBarLinkageTransmissionLoader::getActuatorConfig(const TransmissionInfo&
   for (unsigned int i = 0; i < 2; ++i)
   {
     const unsigned int id = id_map[i];
-    const ParseStatus reduction_status = getActuatorReduction(act_elements[id],
+    const ParseStatus reduction_status = getActuatorReduction(*act_elements[id],
                                                               act_names[id],
                                                               transmission_info.name_,
                                                               true, // Required
@@ -159,9 +159,9 @@ bool FourBarLinkageTransmissionLoader::getJointConfig(const TransmissionInfo& tr
   const std::string JOINT1_ROLE = "joint1";
   const std::string JOINT2_ROLE = "joint2";
 
-  std::vector<TiXmlElement> jnt_elements(2,"");
-  std::vector<std::string>  jnt_names(2);
-  std::vector<std::string>  jnt_roles(2);
+  std::vector<XmlElementConstPtr> jnt_elements(2);
+  std::vector<std::string>        jnt_names(2);
+  std::vector<std::string>        jnt_roles(2);
 
   for (unsigned int i = 0; i < 2; ++i)
   {
@@ -169,11 +169,11 @@ bool FourBarLinkageTransmissionLoader::getJointConfig(const TransmissionInfo& tr
     jnt_names[i] = transmission_info.joints_[i].name_;
 
     // Joint xml element
-    jnt_elements[i] = loadXmlElement(transmission_info.joints_[i].xml_element_);
+    jnt_elements[i] = loadXmlElement(transmission_info.joints_[i]);
 
     // Populate role string
     std::string& jnt_role = jnt_roles[i];
-    const ParseStatus jnt_role_status = getJointRole(jnt_elements[i],
+    const ParseStatus jnt_role_status = getJointRole(*jnt_elements[i],
                                                      jnt_names[i],
                                                      transmission_info.name_,
                                                      true, // Required
@@ -222,7 +222,7 @@ bool FourBarLinkageTransmissionLoader::getJointConfig(const TransmissionInfo& tr
 
     // Parse optional mechanical reductions. Even though it's optional --and to avoid surprises-- we fail if the element
     // is specified but is of the wrong type
-    const ParseStatus reduction_status = getJointReduction(jnt_elements[id],
+    const ParseStatus reduction_status = getJointReduction(*jnt_elements[id],
                                                            jnt_names[id],
                                                            transmission_info.name_,
                                                            false, // Optional
@@ -231,7 +231,7 @@ bool FourBarLinkageTransmissionLoader::getJointConfig(const TransmissionInfo& tr
 
     // Parse optional joint offset. Even though it's optional --and to avoid surprises-- we fail if the element is
     // specified but is of the wrong type
-    const ParseStatus offset_status = getJointOffset(jnt_elements[id],
+    const ParseStatus offset_status = getJointOffset(*jnt_elements[id],
                                                      jnt_names[id],
                                                      transmission_info.name_,
                                                      false, // Optional
@@ -61,34 +61,34 @@ bool JointStateInterfaceProvider::updateJointInterfaces(const TransmissionInfo&
     RawJointData& raw_joint_data = raw_joint_data_map[name]; // Add joint if it does not yet exist
     if(raw_joint_data.hasAbsolutePosition && raw_joint_data.hasTorqueSensor){
       JointStateHandle handle(name,
-                              &raw_joint_data.position,
-                              &raw_joint_data.velocity,
-                              &raw_joint_data.effort,
-                              &raw_joint_data.absolute_position,
-                              &raw_joint_data.torque_sensor);
+                              raw_joint_data.position,
+                              raw_joint_data.velocity,
+                              raw_joint_data.effort,
+                              raw_joint_data.absolute_position,
+                              raw_joint_data.torque_sensor);
       interface.registerHandle(handle);
     }
     else if(raw_joint_data.hasAbsolutePosition){
       JointStateHandle handle(name,
-                              &raw_joint_data.position,
-                              &raw_joint_data.velocity,
-                              &raw_joint_data.effort,
-                              &raw_joint_data.absolute_position);
+                              raw_joint_data.position,
+                              raw_joint_data.velocity,
+                              raw_joint_data.effort,
+                              raw_joint_data.absolute_position);
       interface.registerHandle(handle);
     }
     else if(raw_joint_data.hasTorqueSensor){
       JointStateHandle handle(name,
-                              &raw_joint_data.position,
-                              &raw_joint_data.velocity,
-                              &raw_joint_data.effort,
-                              &raw_joint_data.torque_sensor, true);
+                              raw_joint_data.position,
+                              raw_joint_data.velocity,
+                              raw_joint_data.effort,
+                              raw_joint_data.torque_sensor, true);
       interface.registerHandle(handle);
     }
     else{
       JointStateHandle handle(name,
-                              &raw_joint_data.position,
-                              &raw_joint_data.velocity,
-                              &raw_joint_data.effort);
+                              raw_joint_data.position,
+                              raw_joint_data.velocity,
+                              raw_joint_data.effort);
       interface.registerHandle(handle);
     }
 
@@ -134,15 +134,14 @@ bool JointStateInterfaceProvider::getJointStateData(const TransmissionInfo& tran
     if (raw_joint_data_it == raw_joint_data_map.end()) {return false;} // Joint name not found!
     const RawJointData& raw_joint_data = raw_joint_data_it->second;
 
-    // TODO: Get rid of these const casts!
-    jnt_state_data.position[i] = const_cast<double*>(&(raw_joint_data.position));
-    jnt_state_data.velocity[i] = const_cast<double*>(&(raw_joint_data.velocity));
-    jnt_state_data.effort[i]   = const_cast<double*>(&(raw_joint_data.effort));
+    jnt_state_data.position[i] = raw_joint_data.position;
+    jnt_state_data.velocity[i] = raw_joint_data.velocity;
+    jnt_state_data.effort[i]   = raw_joint_data.effort;
     if(hasAbsolutePosition){
-      jnt_state_data.absolute_position[i]   = const_cast<double*>(&(raw_joint_data.absolute_position));
+      jnt_state_data.absolute_position[i]   = raw_joint_data.absolute_position;
     }
     if(hasTorqueSensor){
-      jnt_state_data.torque_sensor[i]   = const_cast<double*>(&(raw_joint_data.torque_sensor));
+      jnt_state_data.torque_sensor[i]   = raw_joint_data.torque_sensor;
     }
 
   }
@@ -210,10 +209,7 @@ bool JointStateInterfaceProvider::registerTransmission(TransmissionLoaderData& l
   ActuatorToJointStateInterface& interface = *(loader_data.robot_transmissions->get<ActuatorToJointStateInterface>());
 
   // Update transmission interface
-  ActuatorToJointStateHandle handle(handle_data.name,
-                                    handle_data.transmission.get(),
-                                    handle_data.act_state_data,
-                                    handle_data.jnt_state_data);
+  ActuatorToJointStateHandle handle(handle_data.name, handle_data.state_data);
   interface.registerHandle(handle);
   return true;
 }
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+// C++ standard
+#include <sstream>
+
+// Boost
+#include <boost/lexical_cast.hpp>
+
+// ROS
+#include <ros/console.h>
+
+// Pluginlib
+#include <pluginlib/class_list_macros.h>
+
+// ros_control
+#include <hardware_interface/internal/demangle_symbol.h>
+#include <transmission_interface/linear_transmission.h>
+#include <transmission_interface/linear_transmission_loader.h>
+
+namespace transmission_interface
+{
+
+LinearTransmissionLoader::TransmissionPtr LinearTransmissionLoader::load(const TransmissionInfo& transmission_info)
+{
+  const std::size_t n_act = transmission_info.actuators_.size();
+  const std::size_t n_jnt = transmission_info.joints_.size();
+  if (0 == n_act || 0 == n_jnt)
+  {
+    ROS_ERROR_STREAM_NAMED("parser", "Invalid description for transmission '" << transmission_info.name_ <<
+                           "' of type '" << transmission_info.type_ <<
+                           "'. Expected at least one actuator and one joint, got " << n_act << " actuators and " <<
+                           n_jnt << " joints.");
+    return TransmissionPtr();
+  }
+
+  // Coupling matrix rows and offsets, one per joint
+  std::vector<std::vector<double> > coupling(n_jnt);
+  std::vector<double> jnt_offset(n_jnt, 0.0);
+  for (std::size_t i = 0; i < n_jnt; ++i)
+  {
+    const std::string& jnt_name = transmission_info.joints_[i].name_;
+    XmlElementConstPtr joint_el = loadXmlElement(transmission_info.joints_[i]);
+
+    // Parse required coupling coefficients
+    const ParseStatus coupling_status = getJointCoupling(*joint_el, jnt_name, transmission_info.name_, coupling[i]);
+    if (coupling_status != SUCCESS) {return TransmissionPtr();}
+
+    if (n_act != coupling[i].size())
+    {
+      ROS_ERROR_STREAM_NAMED("parser", "Joint '" << jnt_name << "' of transmission '" << transmission_info.name_ <<
+                             "' specifies " << coupling[i].size() << " coupling coefficients, expected one per " <<
+                             "actuator (" << n_act << ").");
+      return TransmissionPtr();
+    }
+
+    // Parse optional joint offset. Even though it's optional --and to avoid surprises-- we fail if the element is
+    // specified but is of the wrong type
+    const ParseStatus offset_status = getJointOffset(*joint_el,
+                                                     jnt_name,
+                                                     transmission_info.name_,
+                                                     false, // Optional
+                                                     jnt_offset[i]);
+    if (offset_status == BAD_TYPE) {return TransmissionPtr();}
+  }
+
+  // Transmission instance
+  try
+  {
+    TransmissionPtr transmission(new LinearTransmission(coupling, jnt_offset));
+    return transmission;
+  }
+  catch(const TransmissionInterfaceException& ex)
+  {
+    using hardware_interface::internal::demangledTypeName;
+    ROS_ERROR_STREAM_NAMED("parser", "Failed to construct transmission '" << transmission_info.name_ << "' of type '" <<
+                           demangledTypeName<LinearTransmission>()<< "'. " << ex.what());
+    return TransmissionPtr();
+  }
+}
+
+LinearTransmissionLoader::ParseStatus
+LinearTransmissionLoader::getJointCoupling(const TiXmlElement&  parent_el,
+                                           const std::string&   joint_name,
+                                           const std::string&   transmission_name,
+                                           std::vector<double>& coupling)
+{
+  // Get XML element
+  const TiXmlElement* coupling_el = parent_el.FirstChildElement("coupling");
+  if (!coupling_el || !coupling_el->GetText())
+  {
+    ROS_ERROR_STREAM_NAMED("parser", "Joint '" << joint_name << "' of transmission '" << transmission_name <<
+                           "' does not specify the required <coupling> element.");
+    return NO_DATA;
+  }
+
+  // Cast to numbers
+  coupling.clear();
+  std::istringstream coupling_stream(coupling_el->GetText());
+  std::string coefficient;
+  while (coupling_stream >> coefficient)
+  {
+    try {coupling.push_back(boost::lexical_cast<double>(coefficient));}
+    catch (const boost::bad_lexical_cast&)
+    {
+      ROS_ERROR_STREAM_NAMED("parser", "Joint '" << joint_name << "' of transmission '" << transmission_name <<
+                             "' specifies the <coupling> element, but '" << coefficient << "' is not a number.");
+      return BAD_TYPE;
+    }
+  }
+  return SUCCESS;
+}
+
+} // namespace
+
+PLUGINLIB_EXPORT_CLASS(transmission_interface::LinearTransmissionLoader,
+                       transmission_interface::TransmissionLoader)
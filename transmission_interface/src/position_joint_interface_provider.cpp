@@ -66,7 +66,7 @@ bool PositionJointInterfaceProvider::updateJointInterfaces(const TransmissionInf
     using hardware_interface::JointHandle;
     RawJointData& raw_joint_data = raw_joint_data_map[name];
     JointHandle handle(joint_interfaces.joint_state_interface.getHandle(joint_info.name_),
-                       &raw_joint_data.position_cmd);
+                       raw_joint_data.position_cmd);
     interface.registerHandle(handle);
   }
   return true;
@@ -86,8 +86,7 @@ bool PositionJointInterfaceProvider::getJointCommandData(const TransmissionInfo&
     if (raw_joint_data_it == raw_joint_data_map.end()) {return false;} // Joint name not found!
     const RawJointData& raw_joint_data = raw_joint_data_it->second;
 
-    // TODO: Get rid of these const casts!
-    jnt_cmd_data.position[i] = const_cast<double*>(&(raw_joint_data.position_cmd));
+    jnt_cmd_data.position[i] = raw_joint_data.position_cmd;
   }
 
   return true;
@@ -135,10 +134,7 @@ bool PositionJointInterfaceProvider::registerTransmission(TransmissionLoaderData
   JointToActuatorPositionInterface& interface = *(loader_data.robot_transmissions->get<JointToActuatorPositionInterface>());
 
   // Setup command interface
-  JointToActuatorPositionHandle handle(handle_data.name,
-                                       handle_data.transmission.get(),
-                                       handle_data.act_cmd_data,
-                                       handle_data.jnt_cmd_data);
+  JointToActuatorPositionHandle handle(handle_data.name, handle_data.cmd_data);
   interface.registerHandle(handle);
   return true;
 }
@@ -46,12 +46,12 @@ SimpleTransmissionLoader::TransmissionPtr SimpleTransmissionLoader::load(const T
   if (!checkJointDimension(transmission_info,    1)) {return TransmissionPtr();}
 
   // Parse actuator and joint xml elements
-  TiXmlElement actuator_el = loadXmlElement(transmission_info.actuators_.front().xml_element_);
-  TiXmlElement joint_el    = loadXmlElement(transmission_info.joints_.front().xml_element_);
+  XmlElementConstPtr actuator_el = loadXmlElement(transmission_info.actuators_.front());
+  XmlElementConstPtr joint_el    = loadXmlElement(transmission_info.joints_.front());
 
   // Parse required mechanical reduction
   double reduction = 0.0;
-  const ParseStatus reduction_status = getActuatorReduction(actuator_el,
+  const ParseStatus reduction_status = getActuatorReduction(*actuator_el,
                                                             transmission_info.actuators_.front().name_,
                                                             transmission_info.name_,
                                                             true, // Required
@@ -61,7 +61,7 @@ SimpleTransmissionLoader::TransmissionPtr SimpleTransmissionLoader::load(const T
   // Parse optional joint offset. Even though it's optional --and to avoid surprises-- we fail if the element is
   // specified but is of the wrong type
   double joint_offset = 0.0;
-  const ParseStatus joint_offset_status = getJointOffset(joint_el,
+  const ParseStatus joint_offset_status = getJointOffset(*joint_el,
                                                          transmission_info.joints_.front().name_,
                                                          transmission_info.name_,
                                                          false, // Optional
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <hardware_interface/internal/binary_cache.h>
+#include <transmission_interface/transmission_info_cache.h>
+
+namespace transmission_interface
+{
+
+namespace
+{
+
+using hardware_interface::internal::BinaryCacheReader;
+using hardware_interface::internal::BinaryCacheWriter;
+
+void write(BinaryCacheWriter& writer, const std::vector<std::string>& strings)
+{
+  writer.write(static_cast<uint32_t>(strings.size()));
+  for (std::size_t i = 0; i < strings.size(); ++i) {writer.write(strings[i]);}
+}
+
+bool read(BinaryCacheReader& reader, std::vector<std::string>& strings)
+{
+  uint32_t size = 0;
+  if (!reader.read(size)) {return false;}
+  strings.resize(size);
+  for (std::size_t i = 0; i < strings.size(); ++i)
+  {
+    if (!reader.read(strings[i])) {return false;}
+  }
+  return true;
+}
+
+void write(BinaryCacheWriter& writer, const JointInfo& info)
+{
+  writer.write(info.name_);
+  write(writer, info.hardware_interfaces_);
+  writer.write(info.role_);
+  writer.write(getXmlElementString(info));
+}
+
+bool read(BinaryCacheReader& reader, JointInfo& info)
+{
+  return reader.read(info.name_) &&
+         read(reader, info.hardware_interfaces_) &&
+         reader.read(info.role_) &&
+         reader.read(info.xml_element_);
+}
+
+void write(BinaryCacheWriter& writer, const ActuatorInfo& info)
+{
+  writer.write(info.name_);
+  write(writer, info.hardware_interfaces_);
+  writer.write(getXmlElementString(info));
+}
+
+bool read(BinaryCacheReader& reader, ActuatorInfo& info)
+{
+  return reader.read(info.name_) &&
+         read(reader, info.hardware_interfaces_) &&
+         reader.read(info.xml_element_);
+}
+
+void write(BinaryCacheWriter& writer, const TransmissionInfo& info);
+bool read(BinaryCacheReader& reader, TransmissionInfo& info);
+
+template <class T>
+void write(BinaryCacheWriter& writer, const std::vector<T>& values)
+{
+  writer.write(static_cast<uint32_t>(values.size()));
+  for (std::size_t i = 0; i < values.size(); ++i) {write(writer, values[i]);}
+}
+
+template <class T>
+bool read(BinaryCacheReader& reader, std::vector<T>& values)
+{
+  uint32_t size = 0;
+  if (!reader.read(size)) {return false;}
+  values.resize(size);
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    if (!read(reader, values[i])) {return false;}
+  }
+  return true;
+}
+
+void write(BinaryCacheWriter& writer, const TransmissionInfo& info)
+{
+  writer.write(info.name_);
+  writer.write(info.type_);
+  write(writer, info.joints_);
+  write(writer, info.actuators_);
+}
+
+bool read(BinaryCacheReader& reader, TransmissionInfo& info)
+{
+  return reader.read(info.name_) &&
+         reader.read(info.type_) &&
+         read(reader, info.joints_) &&
+         read(reader, info.actuators_);
+}
+
+} // namespace
+
+uint64_t transmissionCacheKey(const std::string& urdf)
+{
+  return hardware_interface::internal::fnv1aHash(urdf);
+}
+
+bool writeTransmissionCache(const std::string&                   path,
+                            uint64_t                             key,
+                            const std::vector<TransmissionInfo>& transmissions)
+{
+  BinaryCacheWriter writer;
+  write(writer, transmissions);
+  return writer.save(path, TRANSMISSION_CACHE_FORMAT, key);
+}
+
+bool readTransmissionCache(const std::string&             path,
+                           uint64_t                       key,
+                           std::vector<TransmissionInfo>& transmissions)
+{
+  BinaryCacheReader reader;
+  if (!reader.open(path, TRANSMISSION_CACHE_FORMAT, key)) {return false;}
+
+  std::vector<TransmissionInfo> cached;
+  if (!read(reader, cached) || !reader.atEnd()) {return false;}
+
+  transmissions.swap(cached);
+  return true;
+}
+
+} // namespace
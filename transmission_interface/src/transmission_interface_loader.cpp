@@ -27,6 +27,7 @@
 
 // C++ standard
 #include <cassert>
+#include <set>
 #include <stdexcept>
 
 // ros_control
@@ -36,6 +37,17 @@
 namespace transmission_interface
 {
 
+namespace
+{
+
+bool hasData(const ActuatorData& act_data, const JointData& jnt_data)
+{
+  return !act_data.position.empty() || !act_data.velocity.empty() || !act_data.effort.empty() ||
+         !jnt_data.position.empty() || !jnt_data.velocity.empty() || !jnt_data.effort.empty();
+}
+
+} // namespace
+
 bool RequisiteProvider::loadTransmissionMaps(const TransmissionInfo& transmission_info,
                                              TransmissionLoaderData& loader_data,
                                              TransmissionPtr         transmission)
@@ -76,6 +88,26 @@ bool RequisiteProvider::loadTransmissionMaps(const TransmissionInfo& transmissio
                                                    handle_data.jnt_cmd_data);
   if (!jnt_cmd_data_ok) {return false;}
 
+  // Validate data once, so that all handles registered by the provider share it
+  try
+  {
+    handle_data.state_data = boost::make_shared<ValidatedTransmissionData>(transmission.get(),
+                                                                           handle_data.act_state_data,
+                                                                           handle_data.jnt_state_data);
+    if (hasData(handle_data.act_cmd_data, handle_data.jnt_cmd_data))
+    {
+      handle_data.cmd_data = boost::make_shared<ValidatedTransmissionData>(transmission.get(),
+                                                                           handle_data.act_cmd_data,
+                                                                           handle_data.jnt_cmd_data);
+    }
+  }
+  catch (const TransmissionInterfaceException& ex)
+  {
+    ROS_ERROR_STREAM_NAMED("parser", "Failed to load transmission '" << transmission_info.name_ <<
+                           "'. Its data is invalid.\n" << ex.what());
+    return false;
+  }
+
   // Update transmission interface
   loader_data.transmission_data.push_back(transmission);
 
@@ -87,7 +119,8 @@ bool RequisiteProvider::loadTransmissionMaps(const TransmissionInfo& transmissio
 
 TransmissionInterfaceLoader::TransmissionInterfaceLoader(hardware_interface::RobotHW* robot_hw,
                                                          RobotTransmissions*          robot_transmissions)
-  : robot_hw_ptr_(robot_hw),
+  : load_pool_(0),
+    robot_hw_ptr_(robot_hw),
     robot_transmissions_ptr_(robot_transmissions)
 {
   // Can throw
@@ -108,9 +141,22 @@ TransmissionInterfaceLoader::TransmissionInterfaceLoader(hardware_interface::Rob
 
 bool TransmissionInterfaceLoader::load(const std::string& urdf)
 {
-  TransmissionParser parser;
   std::vector<TransmissionInfo> infos;
-  if (!parser.parse(urdf, infos)) {return false;}
+  const uint64_t cache_key = cache_path_.empty() ? 0 : transmissionCacheKey(urdf);
+  if (!cache_path_.empty() && readTransmissionCache(cache_path_, cache_key, infos))
+  {
+    ROS_DEBUG_STREAM_NAMED("parser", "Read transmissions from cache file '" << cache_path_ << "'.");
+  }
+  else
+  {
+    TransmissionParser parser;
+    if (!parser.parse(urdf, infos)) {return false;}
+
+    if (!cache_path_.empty() && !writeTransmissionCache(cache_path_, cache_key, infos))
+    {
+      ROS_WARN_STREAM_NAMED("parser", "Failed to write transmission cache file '" << cache_path_ << "'.");
+    }
+  }
 
   if (infos.empty())
   {
@@ -123,30 +169,118 @@ bool TransmissionInterfaceLoader::load(const std::string& urdf)
 
 bool TransmissionInterfaceLoader::load(const std::vector<TransmissionInfo>& transmission_info_vec)
 {
+  // Allocate raw data of all new joints in a single contiguous block
+  std::set<std::string> new_joints;
   BOOST_FOREACH(const TransmissionInfo& info, transmission_info_vec)
   {
-    if (!load(info)) {return false;}
+    BOOST_FOREACH(const JointInfo& jnt_info, info.joints_)
+    {
+      if (!loader_data_.raw_joint_data_map.count(jnt_info.name_)) {new_joints.insert(jnt_info.name_);}
+    }
   }
-  return true;
+  loader_data_.raw_joint_data_map.reserve(new_joints.size());
+
+  if (!load_pool_ || transmission_info_vec.size() < 2)
+  {
+    BOOST_FOREACH(const TransmissionInfo& info, transmission_info_vec)
+    {
+      if (!load(info)) {return false;}
+    }
+    return true;
+  }
+
+  // Get plugin instances beforehand, as the plugin cache is not thread-safe.
+  // Transmissions following one of unsupported type would not be loaded serially, so they are not constructed
+  std::vector<TransmissionConstruction> constructions;
+  constructions.reserve(transmission_info_vec.size());
+  bool unsupported_type = false;
+  BOOST_FOREACH(const TransmissionInfo& info, transmission_info_vec)
+  {
+    TransmissionConstruction construction;
+    construction.info = &info;
+    try
+    {
+      construction.loader = getTransmissionLoader(info.type_);
+    }
+    catch(pluginlib::LibraryLoadException &ex)
+    {
+      logUnsupportedType(info, ex);
+      unsupported_type = true;
+      break;
+    }
+    constructions.push_back(construction);
+  }
+
+  // Phase 1: Construct transmissions concurrently
+  load_pool_->run(constructions.size(), &TransmissionInterfaceLoader::constructTransmission, &constructions);
+
+  // Phase 2: Register transmissions serially, stopping at the first failure like serial loading does
+  BOOST_FOREACH(const TransmissionConstruction& construction, constructions)
+  {
+    if (construction.error)
+    {
+      try
+      {
+        std::rethrow_exception(construction.error);
+      }
+      catch(pluginlib::LibraryLoadException &ex)
+      {
+        logUnsupportedType(*construction.info, ex);
+        return false;
+      }
+    }
+    if (!construction.transmission) {return false;}
+    if (!registerTransmission(*construction.info, construction.transmission)) {return false;}
+  }
+  return !unsupported_type;
 }
 
 bool TransmissionInterfaceLoader::load(const TransmissionInfo& transmission_info)
 {
-  // Create transmission instance
-  TransmissionPtr transmission;
+  TransmissionPtr transmission = createTransmission(transmission_info);
+  if (!transmission) {return false;}
+
+  return registerTransmission(transmission_info, transmission);
+}
+
+void TransmissionInterfaceLoader::constructTransmission(void* context, std::size_t i)
+{
+  TransmissionConstruction& construction = (*static_cast<std::vector<TransmissionConstruction>*>(context))[i];
   try
   {
-    TransmissionLoaderPtr transmission_loader = transmission_class_loader_->createInstance(transmission_info.type_);
-    transmission = transmission_loader->load(transmission_info);
-    if (!transmission) {return false;}
+    construction.transmission = construction.loader->load(*construction.info);
+  }
+  catch(...)
+  {
+    construction.error = std::current_exception(); // Exceptions must not escape worker threads
+  }
+}
+
+TransmissionInterfaceLoader::TransmissionPtr
+TransmissionInterfaceLoader::createTransmission(const TransmissionInfo& transmission_info)
+{
+  try
+  {
+    TransmissionLoaderPtr transmission_loader = getTransmissionLoader(transmission_info.type_);
+    return transmission_loader->load(transmission_info);
   }
   catch(pluginlib::LibraryLoadException &ex)
   {
-    ROS_ERROR_STREAM_NAMED("parser", "Failed to load transmission '" << transmission_info.name_ <<
-                           "'. Unsupported type '" << transmission_info.type_ << "'.\n" << ex.what());
-    return false;
+    logUnsupportedType(transmission_info, ex);
+    return TransmissionPtr();
   }
+}
+
+void TransmissionInterfaceLoader::logUnsupportedType(const TransmissionInfo&                 transmission_info,
+                                                     const pluginlib::LibraryLoadException& ex)
+{
+  ROS_ERROR_STREAM_NAMED("parser", "Failed to load transmission '" << transmission_info.name_ <<
+                         "'. Unsupported type '" << transmission_info.type_ << "'.\n" << ex.what());
+}
 
+bool TransmissionInterfaceLoader::registerTransmission(const TransmissionInfo& transmission_info,
+                                                       TransmissionPtr         transmission)
+{
   // We currently only deal with transmissions specifying a single hardware interface in the joints
   assert(!transmission_info.joints_.empty() && !transmission_info.joints_.front().hardware_interfaces_.empty());
   const std::vector<std::string>& hw_ifaces_ref = transmission_info.joints_.front().hardware_interfaces_; // First joint
@@ -171,7 +305,7 @@ bool TransmissionInterfaceLoader::load(const TransmissionInfo& transmission_info
     RequisiteProviderPtr req_provider;
     try
     {
-      req_provider = req_provider_loader_->createInstance(hw_iface);
+      req_provider = getRequisiteProvider(hw_iface);
       if (!req_provider) {continue;}
     }
     catch(pluginlib::LibraryLoadException &ex)
@@ -196,4 +330,26 @@ bool TransmissionInterfaceLoader::load(const TransmissionInfo& transmission_info
   return true;
 }
 
+TransmissionInterfaceLoader::TransmissionLoaderPtr
+TransmissionInterfaceLoader::getTransmissionLoader(const std::string& type)
+{
+  TransmissionLoaderMap::iterator it = transmission_loaders_.lower_bound(type);
+  if (it != transmission_loaders_.end() && it->first == type) {return it->second;}
+
+  TransmissionLoaderPtr transmission_loader = transmission_class_loader_->createInstance(type); // Can throw
+  if (transmission_loader) {transmission_loaders_.insert(it, std::make_pair(type, transmission_loader));}
+  return transmission_loader;
+}
+
+TransmissionInterfaceLoader::RequisiteProviderPtr
+TransmissionInterfaceLoader::getRequisiteProvider(const std::string& hw_iface)
+{
+  RequisiteProviderMap::iterator it = req_providers_.lower_bound(hw_iface);
+  if (it != req_providers_.end() && it->first == hw_iface) {return it->second;}
+
+  RequisiteProviderPtr req_provider = req_provider_loader_->createInstance(hw_iface); // Can throw
+  if (req_provider) {req_providers_.insert(it, std::make_pair(hw_iface, req_provider));}
+  return req_provider;
+}
+
 } // namespace
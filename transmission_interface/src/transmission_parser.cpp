@@ -33,30 +33,161 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  *********************************************************************/
 
+#include <cstring>
 #include <sstream>
 #include <transmission_interface/transmission_parser.h>
 
 namespace transmission_interface
 {
 
+namespace
+{
+
+/// \return Position past the end of the \p terminator that follows \p pos, or npos if there is none.
+std::size_t skipPast(const std::string& xml, std::size_t pos, const char* terminator)
+{
+  const std::size_t end = xml.find(terminator, pos);
+  return (end == std::string::npos) ? end : end + std::strlen(terminator);
+}
+
+/// \return Position past the end of the element tag starting at \p pos, or npos if the tag is not terminated.
+std::size_t skipTag(const std::string& xml, std::size_t pos)
+{
+  // Attribute values may contain '>', so they need to be skipped explicitly
+  for (std::size_t i = pos; i < xml.size(); ++i)
+  {
+    const char c = xml[i];
+    if (c == '"' || c == '\'')
+    {
+      i = xml.find(c, i + 1);
+      if (i == std::string::npos) {return i;}
+    }
+    else if (c == '>') {return i + 1;}
+  }
+  return std::string::npos;
+}
+
+bool nameEquals(const std::string& xml, std::size_t pos, std::size_t len, const char* name)
+{
+  return len == std::strlen(name) && 0 == xml.compare(pos, len, name);
+}
+
+} // namespace
+
+bool TransmissionParser::findTransmissions(const std::string& xml, XmlRanges& transmissions)
+{
+  // Stack of open elements, stored as (position, length) pairs of their names to avoid allocating strings
+  std::vector<XmlRange> open_elements;
+  open_elements.reserve(16);
+
+  std::size_t transmission_begin = 0;
+  bool has_root = false;
+  std::size_t pos = xml.find('<');
+  while (pos != std::string::npos)
+  {
+    if (0 == xml.compare(pos, 4, "<!--"))
+    {
+      pos = skipPast(xml, pos + 4, "-->");
+    }
+    else if (0 == xml.compare(pos, 9, "<![CDATA["))
+    {
+      pos = skipPast(xml, pos + 9, "]]>");
+    }
+    else if (0 == xml.compare(pos, 2, "<?"))
+    {
+      pos = skipPast(xml, pos + 2, "?>");
+    }
+    else if (0 == xml.compare(pos, 2, "<!"))
+    {
+      // Document type declaration, whose internal subset can contain '>' characters
+      const std::size_t subset = xml.find_first_of("[>", pos + 2);
+      pos = (subset != std::string::npos && xml[subset] == '[') ? skipPast(xml, subset, "]>") : skipPast(xml, pos, ">");
+    }
+    else if (0 == xml.compare(pos, 2, "</"))
+    {
+      // End tag, which must match the innermost open element
+      const std::size_t name_begin = pos + 2;
+      const std::size_t name_end   = xml.find_first_of(" \t\r\n>", name_begin);
+      if (open_elements.empty() || name_end == std::string::npos) {return false;}
+
+      const XmlRange& name = open_elements.back();
+      if (name_end - name_begin != name.second ||
+          0 != xml.compare(name_begin, name.second, xml, name.first, name.second))
+      {
+        return false;
+      }
+
+      pos = skipPast(xml, name_end, ">");
+      if (pos == std::string::npos) {return false;}
+
+      if (2 == open_elements.size() && nameEquals(xml, name.first, name.second, "transmission"))
+      {
+        transmissions.push_back(XmlRange(transmission_begin, pos - transmission_begin));
+      }
+      open_elements.pop_back();
+      if (open_elements.empty()) {return true;} // End of root element, trailing content is ignored
+    }
+    else
+    {
+      // Start or empty-element tag
+      const std::size_t name_begin = pos + 1;
+      const std::size_t name_end   = xml.find_first_of(" \t\r\n/>", name_begin);
+      if (name_end == std::string::npos || name_end == name_begin) {return false;}
+      if (open_elements.empty() && has_root) {return false;} // More than one root element
+
+      const std::size_t tag_end = skipTag(xml, name_end);
+      if (tag_end == std::string::npos) {return false;}
+
+      const XmlRange name(name_begin, name_end - name_begin);
+      const bool is_transmission = (1 == open_elements.size() &&
+                                    nameEquals(xml, name.first, name.second, "transmission"));
+      if (xml[tag_end - 2] == '/')
+      {
+        if (is_transmission) {transmissions.push_back(XmlRange(pos, tag_end - pos));}
+      }
+      else
+      {
+        if (is_transmission) {transmission_begin = pos;}
+        open_elements.push_back(name);
+      }
+      has_root = true;
+      pos = tag_end;
+    }
+
+    if (pos == std::string::npos) {return false;} // Unterminated markup
+    pos = xml.find('<', pos);
+  }
+
+  // Reaching the end of the document is only valid if there are no unterminated elements
+  return has_root && open_elements.empty();
+}
+
 bool TransmissionParser::parse(const std::string& urdf, std::vector<TransmissionInfo>& transmissions)
 {
-  // initialize TiXmlDocument doc with a string
-  TiXmlDocument doc;
-  if (!doc.Parse(urdf.c_str()) && doc.Error())
+  // Locate transmission elements without parsing the rest of the document
+  XmlRanges transmission_ranges;
+  if (!findTransmissions(urdf, transmission_ranges))
   {
     ROS_ERROR("Can't parse transmissions. Invalid robot description.");
     return false;
   }
 
-  // Find joints in transmission tags
-  TiXmlElement *root = doc.RootElement();
-
   // Constructs the transmissions by parsing custom xml.
-  TiXmlElement *trans_it = NULL;
-  for (trans_it = root->FirstChildElement("transmission"); trans_it;
-       trans_it = trans_it->NextSiblingElement("transmission"))
+  transmissions.reserve(transmissions.size() + transmission_ranges.size());
+  for (XmlRanges::const_iterator range_it = transmission_ranges.begin(); range_it != transmission_ranges.end();
+       ++range_it)
   {
+    // Each transmission is parsed into its own document, which is shared by the joint and actuator elements handed
+    // to transmission loaders
+    XmlDocumentPtr doc(new TiXmlDocument());
+    const std::string trans_str = urdf.substr(range_it->first, range_it->second);
+    if (!doc->Parse(trans_str.c_str()) && doc->Error())
+    {
+      ROS_ERROR("Can't parse transmissions. Invalid robot description.");
+      return false;
+    }
+    TiXmlElement *trans_it = doc->RootElement();
+
     transmission_interface::TransmissionInfo transmission;
 
     // Transmission name
@@ -92,7 +223,7 @@ bool TransmissionParser::parse(const std::string& urdf, std::vector<Transmission
     transmission.type_ = type_child->GetText();
 
     // Load joints
-    if(!parseJoints(trans_it, transmission.joints_))
+    if(!parseJoints(trans_it, transmission.joints_, doc))
     {
       ROS_ERROR_STREAM_NAMED("parser","Failed to load joints for transmission '"
         << transmission.name_ << "'.");
@@ -100,7 +231,7 @@ bool TransmissionParser::parse(const std::string& urdf, std::vector<Transmission
     }
 
     // Load actuators
-    if(!parseActuators(trans_it, transmission.actuators_))
+    if(!parseActuators(trans_it, transmission.actuators_, doc))
     {
       ROS_ERROR_STREAM_NAMED("parser","Failed to load actuators for transmission '"
         << transmission.name_ << "'.");
@@ -120,7 +251,8 @@ bool TransmissionParser::parse(const std::string& urdf, std::vector<Transmission
   return true;
 }
 
-bool TransmissionParser::parseJoints(TiXmlElement *trans_it, std::vector<JointInfo>& joints)
+bool TransmissionParser::parseJoints(TiXmlElement *trans_it, std::vector<JointInfo>& joints,
+                                     const XmlDocumentPtr& doc)
 {
   // Loop through each available joint
   TiXmlElement *joint_it = NULL;
@@ -168,10 +300,14 @@ bool TransmissionParser::parseJoints(TiXmlElement *trans_it, std::vector<JointIn
       continue;
     }
 
-    // Joint xml element
-    std::stringstream ss;
-    ss << *joint_it;
-    joint.xml_element_ = ss.str();
+    // Joint xml element. Its string representation is only built if the element can't be shared
+    if (doc) {joint.xml_element_ptr_ = boost::shared_ptr<const TiXmlElement>(doc, joint_it);}
+    else
+    {
+      std::stringstream ss;
+      ss << *joint_it;
+      joint.xml_element_ = ss.str();
+    }
 
     // Add joint to vector
     joints.push_back(joint);
@@ -186,7 +322,8 @@ bool TransmissionParser::parseJoints(TiXmlElement *trans_it, std::vector<JointIn
   return true;
 }
 
-bool TransmissionParser::parseActuators(TiXmlElement *trans_it, std::vector<ActuatorInfo>& actuators)
+bool TransmissionParser::parseActuators(TiXmlElement *trans_it, std::vector<ActuatorInfo>& actuators,
+                                        const XmlDocumentPtr& doc)
 {
   // Loop through each available actuator
   TiXmlElement *actuator_it = NULL;
@@ -234,10 +371,14 @@ bool TransmissionParser::parseActuators(TiXmlElement *trans_it, std::vector<Actu
       // continue; // NOTE: Hardware interface is optional, so we keep on going
     }
 
-    // Actuator xml element
-    std::stringstream ss;
-    ss << *actuator_it;
-    actuator.xml_element_ = ss.str();
+    // Actuator xml element. Its string representation is only built if the element can't be shared
+    if (doc) {actuator.xml_element_ptr_ = boost::shared_ptr<const TiXmlElement>(doc, actuator_it);}
+    else
+    {
+      std::stringstream ss;
+      ss << *actuator_it;
+      actuator.xml_element_ = ss.str();
+    }
 
     // Add actuator to vector
     actuators.push_back(actuator);
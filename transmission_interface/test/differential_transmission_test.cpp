@@ -31,6 +31,7 @@
 
 #include <transmission_interface/differential_transmission.h>
 #include "random_generator_utils.h"
+#include "state_map_utils.h"
 
 using namespace transmission_interface;
 using std::vector;
@@ -545,6 +546,74 @@ TEST_F(WhiteBoxTest, MoveBothJoints)
   }
 }
 
+TEST(FusedStateMapTest, CompareWithIndividualMaps)
+{
+  vector<double> act_reduction(2);
+  act_reduction[0] =  2.0;
+  act_reduction[1] = -3.0;
+
+  vector<double> jnt_reduction(2);
+  jnt_reduction[0] =  4.0;
+  jnt_reduction[1] = -5.0;
+
+  vector<double> jnt_offset(2);
+  jnt_offset[0] =  1.0;
+  jnt_offset[1] = -1.0;
+
+  DifferentialTransmission trans(false, act_reduction, jnt_reduction, jnt_offset);
+  testFusedStateMap(trans);
+
+  DifferentialTransmission trans_ignore_abs(true, act_reduction, jnt_reduction, jnt_offset);
+  testFusedStateMap(trans_ignore_abs);
+}
+
+TEST(FixedDataTest, CompareWithDynamicData)
+{
+  vector<double> act_reduction(2);
+  act_reduction[0] =  2.0;
+  act_reduction[1] = -3.0;
+
+  vector<double> jnt_reduction(2);
+  jnt_reduction[0] =  4.0;
+  jnt_reduction[1] = -5.0;
+
+  vector<double> jnt_offset(2);
+  jnt_offset[0] =  1.0;
+  jnt_offset[1] = -1.0;
+
+  DifferentialTransmission trans(false, act_reduction, jnt_reduction, jnt_offset);
+  testFixedDataMaps<2>(trans);
+
+  DifferentialTransmission trans_ignore_abs(true, act_reduction, jnt_reduction, jnt_offset);
+  testFixedDataMaps<2>(trans_ignore_abs);
+}
+
+TEST(FixedDataTest, Conversion)
+{
+  double val[3] = {0.0, 0.0, 0.0};
+
+  ActuatorData act_data;
+  act_data.position.push_back(&val[0]);
+  act_data.position.push_back(&val[1]);
+
+  // Available variables keep their pointers, unavailable ones are null
+  FixedActuatorData<2> fixed_act_data = toFixedActuatorData<2>(act_data);
+  EXPECT_EQ(&val[0], fixed_act_data.position[0]);
+  EXPECT_EQ(&val[1], fixed_act_data.position[1]);
+  EXPECT_TRUE(0 == fixed_act_data.velocity[0] && 0 == fixed_act_data.velocity[1]);
+
+  // Size mismatch
+  EXPECT_THROW(toFixedActuatorData<3>(act_data), TransmissionInterfaceException);
+  act_data.position.push_back(&val[2]);
+  EXPECT_THROW(toFixedActuatorData<2>(act_data), TransmissionInterfaceException);
+
+  // Null data
+  JointData jnt_data;
+  jnt_data.effort.push_back(&val[0]);
+  jnt_data.effort.push_back(0);
+  EXPECT_THROW(toFixedJointData<2>(jnt_data), TransmissionInterfaceException);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -31,6 +31,7 @@
 
 #include <transmission_interface/four_bar_linkage_transmission.h>
 #include "random_generator_utils.h"
+#include "state_map_utils.h"
 
 using namespace transmission_interface;
 using std::vector;
@@ -548,6 +549,42 @@ TEST_F(WhiteBoxTest, MoveBothJoints)
   }
 }
 
+TEST(FusedStateMapTest, CompareWithIndividualMaps)
+{
+  vector<double> act_reduction(2);
+  act_reduction[0] =  2.0;
+  act_reduction[1] = -3.0;
+
+  vector<double> jnt_reduction(2);
+  jnt_reduction[0] =  4.0;
+  jnt_reduction[1] = -5.0;
+
+  vector<double> jnt_offset(2);
+  jnt_offset[0] =  1.0;
+  jnt_offset[1] = -1.0;
+
+  FourBarLinkageTransmission trans(act_reduction, jnt_reduction, jnt_offset);
+  testFusedStateMap(trans);
+}
+
+TEST(FixedDataTest, CompareWithDynamicData)
+{
+  vector<double> act_reduction(2);
+  act_reduction[0] =  2.0;
+  act_reduction[1] = -3.0;
+
+  vector<double> jnt_reduction(2);
+  jnt_reduction[0] =  4.0;
+  jnt_reduction[1] = -5.0;
+
+  vector<double> jnt_offset(2);
+  jnt_offset[0] =  1.0;
+  jnt_offset[1] = -1.0;
+
+  FourBarLinkageTransmission trans(act_reduction, jnt_reduction, jnt_offset);
+  testFixedDataMaps<2>(trans);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
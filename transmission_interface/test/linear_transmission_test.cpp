@@ -0,0 +1,283 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <transmission_interface/differential_transmission.h>
+#include <transmission_interface/linear_transmission.h>
+#include <transmission_interface/simple_transmission.h>
+#include "random_generator_utils.h"
+#include "state_map_utils.h"
+
+using namespace transmission_interface;
+using std::vector;
+
+// Floating-point value comparison threshold
+const double EPS = 1e-6;
+
+typedef vector<vector<double> > Matrix;
+
+Matrix makeMatrix(std::size_t rows, std::size_t cols, const double* vals)
+{
+  Matrix out(rows);
+  for (std::size_t i = 0; i < rows; ++i) {out[i].assign(vals + i * cols, vals + (i + 1) * cols);}
+  return out;
+}
+
+// Three joints coupled to four tendon actuators
+Matrix tendonMatrix()
+{
+  const double vals[] = {0.5,  0.5, 0.0,  0.0,
+                         0.0,  0.25, 0.25, 0.0,
+                         0.1, -0.2, 0.3,  -0.4};
+  return makeMatrix(3, 4, vals);
+}
+
+TEST(PreconditionsTest, ExceptionThrowing)
+{
+  const Matrix good = tendonMatrix();
+
+  // Invalid instance creation: Empty matrix
+  const Matrix empty_rows;
+  const Matrix empty_cols(2, vector<double>());
+  EXPECT_THROW(LinearTransmission trans(empty_rows), TransmissionInterfaceException);
+  EXPECT_THROW(LinearTransmission trans(empty_cols), TransmissionInterfaceException);
+
+  // Invalid instance creation: Rows of different size
+  Matrix ragged = good;
+  ragged[1].pop_back();
+  EXPECT_THROW(LinearTransmission trans(ragged), TransmissionInterfaceException);
+
+  // Invalid instance creation: Wrong offset size
+  EXPECT_THROW(LinearTransmission trans(good, vector<double>(2, 0.0)), TransmissionInterfaceException);
+
+  // Invalid instance creation: Rank-deficient matrix
+  const double singular_vals[] = {1.0, 2.0,
+                                  2.0, 4.0};
+  const Matrix singular = makeMatrix(2, 2, singular_vals);
+  const Matrix zero(1, vector<double>(3, 0.0));
+  EXPECT_THROW(LinearTransmission trans(singular), TransmissionInterfaceException);
+  EXPECT_THROW(LinearTransmission trans(zero),     TransmissionInterfaceException);
+
+  // Invalid instance creation: Too many actuators
+  const Matrix wide(1, vector<double>(LinearTransmission::MAX_DIMENSION + 1, 1.0));
+  EXPECT_THROW(LinearTransmission trans(wide), TransmissionInterfaceException);
+
+  // Valid instance creation
+  EXPECT_NO_THROW(LinearTransmission trans(good));
+  EXPECT_NO_THROW(LinearTransmission trans(good, vector<double>(3, 1.0)));
+}
+
+TEST(PreconditionsTest, AccessorValidation)
+{
+  LinearTransmission trans(tendonMatrix(), vector<double>(3, 1.0));
+
+  EXPECT_EQ(4, trans.numActuators());
+  EXPECT_EQ(3, trans.numJoints());
+  EXPECT_EQ(tendonMatrix(), trans.getActuatorToJointMatrix());
+  EXPECT_EQ(vector<double>(3, 1.0), trans.getJointOffset());
+
+  // Pseudo-inverse is a right inverse of the full row rank coupling matrix
+  const Matrix c     = trans.getActuatorToJointMatrix();
+  const Matrix c_inv = trans.getJointToActuatorMatrix();
+  ASSERT_EQ(4, c_inv.size());
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      double val = 0.0;
+      for (std::size_t k = 0; k < 4; ++k) {val += c[i][k] * c_inv[k][j];}
+      EXPECT_NEAR(i == j ? 1.0 : 0.0, val, EPS);
+    }
+  }
+}
+
+/// Raw data and data pointers for one state variable of a transmission.
+struct VariableData
+{
+  VariableData(std::size_t n_act, std::size_t n_jnt)
+    : act_vals(n_act), jnt_vals(n_jnt)
+  {
+    for (std::size_t i = 0; i < n_act; ++i) {act_ptrs.push_back(&act_vals[i]);}
+    for (std::size_t i = 0; i < n_jnt; ++i) {jnt_ptrs.push_back(&jnt_vals[i]);}
+  }
+
+  vector<double>  act_vals;
+  vector<double>  jnt_vals;
+  vector<double*> act_ptrs;
+  vector<double*> jnt_ptrs;
+};
+
+/// Check that two transmissions implement the same maps, for random data.
+void testSameMaps(Transmission& trans, Transmission& ref_trans)
+{
+  ASSERT_EQ(ref_trans.numActuators(), trans.numActuators());
+  ASSERT_EQ(ref_trans.numJoints(),    trans.numJoints());
+
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  const std::size_t n_act = trans.numActuators();
+  const std::size_t n_jnt = trans.numJoints();
+
+  VariableData data(n_act, n_jnt);
+  VariableData ref_data(n_act, n_jnt);
+
+  ActuatorData act_data;     act_data.position     = data.act_ptrs;     act_data.velocity     = data.act_ptrs;
+                             act_data.effort       = data.act_ptrs;
+  JointData    jnt_data;     jnt_data.position     = data.jnt_ptrs;     jnt_data.velocity     = data.jnt_ptrs;
+                             jnt_data.effort       = data.jnt_ptrs;
+  ActuatorData ref_act_data; ref_act_data.position = ref_data.act_ptrs; ref_act_data.velocity = ref_data.act_ptrs;
+                             ref_act_data.effort   = ref_data.act_ptrs;
+  JointData    ref_jnt_data; ref_jnt_data.position = ref_data.jnt_ptrs; ref_jnt_data.velocity = ref_data.jnt_ptrs;
+                             ref_jnt_data.effort   = ref_data.jnt_ptrs;
+
+  void (Transmission::*a2j[])(const ActuatorData&, JointData&) = {&Transmission::actuatorToJointPosition,
+                                                                  &Transmission::actuatorToJointVelocity,
+                                                                  &Transmission::actuatorToJointEffort};
+  void (Transmission::*j2a[])(const JointData&, ActuatorData&) = {&Transmission::jointToActuatorPosition,
+                                                                  &Transmission::jointToActuatorVelocity,
+                                                                  &Transmission::jointToActuatorEffort};
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    // Copy in place, as data pointers refer to the value vectors
+    const vector<double> act_vals = randomVector(n_act, generator);
+    std::copy(act_vals.begin(), act_vals.end(), data.act_vals.begin());
+    std::copy(act_vals.begin(), act_vals.end(), ref_data.act_vals.begin());
+    (trans.*a2j[i])(act_data, jnt_data);
+    (ref_trans.*a2j[i])(ref_act_data, ref_jnt_data);
+    for (std::size_t j = 0; j < n_jnt; ++j) {EXPECT_NEAR(ref_data.jnt_vals[j], data.jnt_vals[j], EPS);}
+
+    const vector<double> jnt_vals = randomVector(n_jnt, generator);
+    std::copy(jnt_vals.begin(), jnt_vals.end(), data.jnt_vals.begin());
+    std::copy(jnt_vals.begin(), jnt_vals.end(), ref_data.jnt_vals.begin());
+    (trans.*j2a[i])(jnt_data, act_data);
+    (ref_trans.*j2a[i])(ref_jnt_data, ref_act_data);
+    for (std::size_t j = 0; j < n_act; ++j) {EXPECT_NEAR(ref_data.act_vals[j], data.act_vals[j], EPS);}
+  }
+}
+
+TEST(EquivalenceTest, SimpleTransmission)
+{
+  SimpleTransmission ref_trans(-10.0, 1.0);
+  LinearTransmission trans(Matrix(1, vector<double>(1, -0.1)), vector<double>(1, 1.0));
+  testSameMaps(trans, ref_trans);
+}
+
+TEST(EquivalenceTest, DifferentialTransmission)
+{
+  vector<double> act_reduction(2);
+  act_reduction[0] =  2.0;
+  act_reduction[1] = -3.0;
+
+  vector<double> jnt_reduction(2);
+  jnt_reduction[0] =  4.0;
+  jnt_reduction[1] = -5.0;
+
+  vector<double> jnt_offset(2);
+  jnt_offset[0] =  1.0;
+  jnt_offset[1] = -1.0;
+
+  DifferentialTransmission ref_trans(false, act_reduction, jnt_reduction, jnt_offset);
+
+  Matrix coupling(2, vector<double>(2));
+  coupling[0][0] =  1.0 / (2.0 * act_reduction[0] * jnt_reduction[0]);
+  coupling[0][1] =  1.0 / (2.0 * act_reduction[1] * jnt_reduction[0]);
+  coupling[1][0] =  1.0 / (2.0 * act_reduction[0] * jnt_reduction[1]);
+  coupling[1][1] = -1.0 / (2.0 * act_reduction[1] * jnt_reduction[1]);
+  LinearTransmission trans(coupling, jnt_offset);
+
+  testSameMaps(trans, ref_trans);
+}
+
+TEST(RectangularTest, JointSpaceRoundTrip)
+{
+  LinearTransmission trans(tendonMatrix(), vector<double>(3, 0.5));
+
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  VariableData data(4, 3);
+  ActuatorData act_data;
+  JointData    jnt_data;
+  act_data.position = data.act_ptrs;
+  jnt_data.position = data.jnt_ptrs;
+
+  // Joint positions are recovered after mapping them to actuator space and back
+  const vector<double> jnt_pos = randomVector(3, generator);
+  std::copy(jnt_pos.begin(), jnt_pos.end(), data.jnt_vals.begin());
+  trans.jointToActuatorPosition(jnt_data, act_data);
+  std::fill(data.jnt_vals.begin(), data.jnt_vals.end(), 0.0);
+  trans.actuatorToJointPosition(act_data, jnt_data);
+  for (std::size_t i = 0; i < 3; ++i) {EXPECT_NEAR(jnt_pos[i], data.jnt_vals[i], EPS);}
+}
+
+TEST(RectangularTest, PowerConservation)
+{
+  LinearTransmission trans(tendonMatrix());
+
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  VariableData vel(4, 3);
+  VariableData eff(4, 3);
+  ActuatorData act_data;
+  JointData    jnt_data;
+  act_data.velocity = vel.act_ptrs;
+  act_data.effort   = eff.act_ptrs;
+  jnt_data.velocity = vel.jnt_ptrs;
+  jnt_data.effort   = eff.jnt_ptrs;
+
+  const vector<double> act_vel = randomVector(4, generator);
+  const vector<double> jnt_eff = randomVector(3, generator);
+  std::copy(act_vel.begin(), act_vel.end(), vel.act_vals.begin());
+  std::copy(jnt_eff.begin(), jnt_eff.end(), eff.jnt_vals.begin());
+  trans.actuatorToJointVelocity(act_data, jnt_data);
+  trans.jointToActuatorEffort(jnt_data, act_data);
+
+  double act_power = 0.0;
+  double jnt_power = 0.0;
+  for (std::size_t i = 0; i < 4; ++i) {act_power += vel.act_vals[i] * eff.act_vals[i];}
+  for (std::size_t i = 0; i < 3; ++i) {jnt_power += vel.jnt_vals[i] * eff.jnt_vals[i];}
+  EXPECT_NEAR(act_power, jnt_power, EPS * std::max(1.0, std::abs(act_power)));
+}
+
+TEST(FusedStateMapTest, CompareWithIndividualMaps)
+{
+  LinearTransmission trans(tendonMatrix(), vector<double>(3, 1.0));
+  testFusedStateMap(trans);
+
+  // More joints than actuators
+  const double tall_vals[] = { 1.0, 0.0,
+                               0.5, 0.5,
+                              -1.0, 2.0};
+  LinearTransmission tall_trans(makeMatrix(3, 2, tall_vals));
+  testFusedStateMap(tall_trans);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <transmission_interface/differential_transmission.h>
+#include <transmission_interface/simple_transmission_batch.h>
+#include <transmission_interface/simple_transmission_batch_propagator.h>
+#include "random_generator_utils.h"
+
+using std::vector;
+using namespace transmission_interface;
+
+TEST(SimpleTransmissionBatchTest, ExceptionThrowing)
+{
+  SimpleTransmission trans(2.0);
+  double val = 0.0;
+
+  ActuatorData a_data;
+  JointData    j_data;
+  EXPECT_NO_THROW(SimpleTransmissionBatch().addTransmission(trans, a_data, j_data));
+
+  // Mismatched actuator and joint data
+  a_data.position.push_back(&val);
+  EXPECT_THROW(SimpleTransmissionBatch().addTransmission(trans, a_data, j_data), TransmissionInterfaceException);
+
+  // Null pointers
+  j_data.position.push_back(0);
+  EXPECT_THROW(SimpleTransmissionBatch().addTransmission(trans, a_data, j_data), TransmissionInterfaceException);
+
+  // Too much data
+  j_data.position[0] = &val;
+  a_data.velocity = vector<double*>(2, &val);
+  j_data.velocity = vector<double*>(2, &val);
+  SimpleTransmissionBatch batch;
+  EXPECT_THROW(batch.addTransmission(trans, a_data, j_data), TransmissionInterfaceException);
+  EXPECT_EQ(0, batch.size());
+
+  a_data.velocity.resize(1);
+  j_data.velocity.resize(1);
+  EXPECT_NO_THROW(batch.addTransmission(trans, a_data, j_data));
+  EXPECT_EQ(1, batch.size());
+}
+
+/**
+ * \brief Compares the results of a batch with those of the individual transmissions it was built from.
+ */
+class SimpleTransmissionBatchCompareTest : public ::testing::Test
+{
+public:
+  SimpleTransmissionBatchCompareTest()
+    : n(37) // Not a multiple of common SIMD widths
+  {
+    RandomDoubleGenerator reduction_generator(-10.0, 10.0);
+    RandomDoubleGenerator offset_generator(-1.0, 1.0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double reduction = reduction_generator();
+      if (reduction == 0.0) {reduction = 1.0;}
+      transmissions.push_back(SimpleTransmission(reduction, offset_generator()));
+    }
+
+    act_vals.resize(5, vector<double>(n));
+    jnt_vals.resize(5, vector<double>(n));
+    ref_vals.resize(5, vector<double>(n));
+    a_data.resize(n);
+    j_data.resize(n);
+    ref_a_data.resize(n);
+    ref_j_data.resize(n);
+
+    // Every third transmission has no effort data, and only even ones have absolute position data
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      setData(a_data[i].position,          j_data[i].position,          0, i, act_vals, jnt_vals);
+      setData(a_data[i].velocity,          j_data[i].velocity,          1, i, act_vals, jnt_vals);
+      if (i % 3) {setData(a_data[i].effort, j_data[i].effort,           2, i, act_vals, jnt_vals);}
+      if (!(i % 2)) {setData(a_data[i].absolute_position, j_data[i].absolute_position, 3, i, act_vals, jnt_vals);}
+      setData(a_data[i].torque_sensor,     j_data[i].torque_sensor,     4, i, act_vals, jnt_vals);
+
+      // Reference data: Actuator data is shared, joint data is not
+      ref_a_data[i] = a_data[i];
+      setData(ref_a_data[i].position,      ref_j_data[i].position,      0, i, act_vals, ref_vals);
+      setData(ref_a_data[i].velocity,      ref_j_data[i].velocity,      1, i, act_vals, ref_vals);
+      if (i % 3) {setData(ref_a_data[i].effort, ref_j_data[i].effort,   2, i, act_vals, ref_vals);}
+      if (!(i % 2)) {setData(ref_a_data[i].absolute_position, ref_j_data[i].absolute_position, 3, i, act_vals, ref_vals);}
+      setData(ref_a_data[i].torque_sensor, ref_j_data[i].torque_sensor, 4, i, act_vals, ref_vals);
+
+      batch.addTransmission(transmissions[i], a_data[i], j_data[i]);
+    }
+  }
+
+protected:
+  std::size_t n;
+  vector<SimpleTransmission> transmissions;
+  vector<vector<double> > act_vals, jnt_vals, ref_vals;
+  vector<ActuatorData> a_data, ref_a_data;
+  vector<JointData>    j_data, ref_j_data;
+  SimpleTransmissionBatch batch;
+
+  static void setData(vector<double*>& act, vector<double*>& jnt, std::size_t field, std::size_t i,
+                      vector<vector<double> >& act_vals, vector<vector<double> >& jnt_vals)
+  {
+    act = vector<double*>(1, &act_vals[field][i]);
+    jnt = vector<double*>(1, &jnt_vals[field][i]);
+  }
+
+  void randomize(vector<vector<double> >& vals)
+  {
+    RandomDoubleGenerator generator(-1000.0, 1000.0);
+    // Values are modified in place, as transmission data points to them
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+      const vector<double> rand_vals = randomVector(n, generator);
+      std::copy(rand_vals.begin(), rand_vals.end(), vals[i].begin());
+    }
+  }
+};
+
+TEST_F(SimpleTransmissionBatchCompareTest, ActuatorToJoint)
+{
+  randomize(act_vals);
+  batch.actuatorToJointState();
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    transmissions[i].actuatorToJointPosition(ref_a_data[i], ref_j_data[i]);
+    transmissions[i].actuatorToJointVelocity(ref_a_data[i], ref_j_data[i]);
+    if (i % 3) {transmissions[i].actuatorToJointEffort(ref_a_data[i], ref_j_data[i]);}
+    if (!(i % 2)) {transmissions[i].actuatorToJointAbsolutePosition(ref_a_data[i], ref_j_data[i]);}
+    transmissions[i].actuatorToJointTorqueSensor(ref_a_data[i], ref_j_data[i]);
+  }
+
+  // Results must be bitwise identical
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    for (std::size_t j = 0; j < n; ++j) {EXPECT_EQ(ref_vals[i][j], jnt_vals[i][j]);}
+  }
+}
+
+TEST_F(SimpleTransmissionBatchCompareTest, JointToActuator)
+{
+  // Reference and batch joint values are the same, and the reference writes to its own actuator values
+  randomize(jnt_vals);
+  for (std::size_t i = 0; i < 5; ++i) {std::copy(jnt_vals[i].begin(), jnt_vals[i].end(), ref_vals[i].begin());}
+  vector<vector<double> > ref_act_vals(5, vector<double>(n));
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    setData(ref_a_data[i].position, ref_j_data[i].position, 0, i, ref_act_vals, ref_vals);
+    setData(ref_a_data[i].velocity, ref_j_data[i].velocity, 1, i, ref_act_vals, ref_vals);
+    if (i % 3) {setData(ref_a_data[i].effort, ref_j_data[i].effort, 2, i, ref_act_vals, ref_vals);}
+  }
+
+  batch.jointToActuatorState();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    transmissions[i].jointToActuatorPosition(ref_j_data[i], ref_a_data[i]);
+    transmissions[i].jointToActuatorVelocity(ref_j_data[i], ref_a_data[i]);
+    if (i % 3) {transmissions[i].jointToActuatorEffort(ref_j_data[i], ref_a_data[i]);}
+  }
+
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    for (std::size_t j = 0; j < n; ++j) {EXPECT_EQ(ref_act_vals[i][j], act_vals[i][j]);}
+  }
+}
+
+ActuatorToJointPositionHandle makePositionHandle(const std::string& name, Transmission* trans,
+                                                 const vector<double*>& act_pos, const vector<double*>& jnt_pos)
+{
+  ActuatorData a_data;
+  JointData    j_data;
+  a_data.position = act_pos;
+  j_data.position = jnt_pos;
+  return ActuatorToJointPositionHandle(name, trans, a_data, j_data);
+}
+
+TEST(SimpleTransmissionBatchPropagatorTest, MixedHandles)
+{
+  // Four independent simple transmissions, two chained ones and a differential. Positions 8 and 9 link the chain
+  vector<SimpleTransmission> simple;
+  for (std::size_t i = 0; i < 6; ++i) {simple.push_back(SimpleTransmission(2.0 + i, 0.5 * i));}
+  DifferentialTransmission diff(false, vector<double>(2, 10.0), vector<double>(2, 2.0));
+
+  vector<double> a_pos(8), j_pos(10), ref_j_pos(10);
+  ActuatorToJointPositionInterface iface, ref_iface;
+  const std::string names[] = {"simple_0", "simple_1", "simple_2", "simple_3", "simple_4", "simple_5"};
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    iface.registerHandle(makePositionHandle(names[i], &simple[i], vector<double*>(1, &a_pos[i]),
+                                            vector<double*>(1, &j_pos[i])));
+    ref_iface.registerHandle(makePositionHandle(names[i], &simple[i], vector<double*>(1, &a_pos[i]),
+                                                vector<double*>(1, &ref_j_pos[i])));
+  }
+  iface.registerHandle(makePositionHandle(names[4], &simple[4], vector<double*>(1, &a_pos[4]),
+                                          vector<double*>(1, &j_pos[8])));
+  ref_iface.registerHandle(makePositionHandle(names[4], &simple[4], vector<double*>(1, &a_pos[4]),
+                                              vector<double*>(1, &ref_j_pos[8])));
+  iface.registerHandle(makePositionHandle(names[5], &simple[5], vector<double*>(1, &j_pos[8]),
+                                          vector<double*>(1, &j_pos[9])));
+  ref_iface.registerHandle(makePositionHandle(names[5], &simple[5], vector<double*>(1, &ref_j_pos[8]),
+                                              vector<double*>(1, &ref_j_pos[9])));
+
+  vector<double*> diff_a_pos, diff_j_pos, diff_ref_j_pos;
+  for (std::size_t i = 6; i < 8; ++i)
+  {
+    diff_a_pos.push_back(&a_pos[i]);
+    diff_j_pos.push_back(&j_pos[i]);
+    diff_ref_j_pos.push_back(&ref_j_pos[i]);
+  }
+  iface.registerHandle(makePositionHandle("diff", &diff, diff_a_pos, diff_j_pos));
+  ref_iface.registerHandle(makePositionHandle("diff", &diff, diff_a_pos, diff_ref_j_pos));
+
+  typedef SimpleTransmissionBatchPropagator<ActuatorToJointPositionHandle> Propagator;
+  boost::shared_ptr<Propagator> propagator(new Propagator());
+  iface.setPropagator(propagator);
+  EXPECT_EQ(4, propagator->getBatchSize());
+
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  const vector<double> rand_vals = randomVector(a_pos.size(), generator);
+  std::copy(rand_vals.begin(), rand_vals.end(), a_pos.begin());
+  iface.propagate();
+  ref_iface.propagate();
+  for (std::size_t i = 0; i < j_pos.size(); ++i) {EXPECT_EQ(ref_j_pos[i], j_pos[i]);}
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -62,6 +62,18 @@ TEST(SimpleTransmissionLoaderTest, FullSpec)
   ASSERT_TRUE(0 != simple_transmission);
   EXPECT_EQ(50.0, simple_transmission->getActuatorReduction());
   EXPECT_EQ( 0.5, simple_transmission->getJointOffset());
+
+  // Same transmission from the string representations of the XML elements, as read from a cache
+  TransmissionInfo string_info = info;
+  string_info.actuators_.front().xml_element_ = getXmlElementString(info.actuators_.front());
+  string_info.actuators_.front().xml_element_ptr_.reset();
+  string_info.joints_.front().xml_element_ = getXmlElementString(info.joints_.front());
+  string_info.joints_.front().xml_element_ptr_.reset();
+  transmission = transmission_loader->load(string_info);
+  simple_transmission = dynamic_cast<SimpleTransmission*>(transmission.get());
+  ASSERT_TRUE(0 != simple_transmission);
+  EXPECT_EQ(50.0, simple_transmission->getActuatorReduction());
+  EXPECT_EQ( 0.5, simple_transmission->getJointOffset());
 }
 
 TEST(SimpleTransmissionLoaderTest, MinimalSpec)
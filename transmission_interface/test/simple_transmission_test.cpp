@@ -32,6 +32,7 @@
 #include <gtest/gtest.h>
 
 #include <transmission_interface/simple_transmission.h>
+#include "state_map_utils.h"
 
 using std::vector;
 using namespace transmission_interface;
@@ -294,6 +295,12 @@ TEST_F(WhiteBoxTest, MoveJoint)
   }
 }
 
+TEST(FusedStateMapTest, CompareWithIndividualMaps)
+{
+  SimpleTransmission trans(-10.0, 1.0);
+  testFusedStateMap(trans);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
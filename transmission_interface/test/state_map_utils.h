@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSMISSION_INTERFACE_STATE_MAP_UTILS_H
+#define TRANSMISSION_INTERFACE_STATE_MAP_UTILS_H
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <transmission_interface/fixed_transmission_data.h>
+#include <transmission_interface/transmission.h>
+#include "random_generator_utils.h"
+
+/// \brief Raw actuator and joint data for all state variables of a transmission.
+struct StateData
+{
+  StateData(std::size_t n_act, std::size_t n_jnt)
+    : act_vals(5, std::vector<double>(n_act)),
+      jnt_vals(5, std::vector<double>(n_jnt))
+  {
+    std::vector<double*>* act_fields[] = {&act_data.position, &act_data.velocity, &act_data.effort,
+                                          &act_data.absolute_position, &act_data.torque_sensor};
+    std::vector<double*>* jnt_fields[] = {&jnt_data.position, &jnt_data.velocity, &jnt_data.effort,
+                                          &jnt_data.absolute_position, &jnt_data.torque_sensor};
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      for (std::size_t j = 0; j < n_act; ++j) {act_fields[i]->push_back(&act_vals[i][j]);}
+      for (std::size_t j = 0; j < n_jnt; ++j) {jnt_fields[i]->push_back(&jnt_vals[i][j]);}
+    }
+  }
+
+  std::vector<std::vector<double> > act_vals;
+  std::vector<std::vector<double> > jnt_vals;
+  transmission_interface::ActuatorData act_data;
+  transmission_interface::JointData    jnt_data;
+};
+
+/**
+ * \brief Check that the fused actuator to joint state map of a transmission yields the same results as the individual
+ * maps, with and without absolute position and torque sensor data.
+ */
+inline void testFusedStateMap(transmission_interface::Transmission& trans)
+{
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  for (std::size_t with_extras = 0; with_extras < 2; ++with_extras)
+  {
+    StateData fused(trans.numActuators(), trans.numJoints());
+    StateData ref(trans.numActuators(), trans.numJoints());
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      const std::vector<double> vals = randomVector(trans.numActuators(), generator);
+      std::copy(vals.begin(), vals.end(), fused.act_vals[i].begin()); // In place, as data pointers refer to it
+    }
+    ref.act_vals = fused.act_vals; // Same size, so no reallocation invalidates data pointers
+
+    if (!with_extras)
+    {
+      fused.act_data.absolute_position.clear();
+      fused.act_data.torque_sensor.clear();
+      ref.act_data.absolute_position.clear();
+      ref.act_data.torque_sensor.clear();
+    }
+
+    trans.actuatorToJointState(fused.act_data, fused.jnt_data);
+
+    trans.actuatorToJointPosition(ref.act_data, ref.jnt_data);
+    trans.actuatorToJointVelocity(ref.act_data, ref.jnt_data);
+    trans.actuatorToJointEffort(ref.act_data, ref.jnt_data);
+    if (with_extras)
+    {
+      trans.actuatorToJointAbsolutePosition(ref.act_data, ref.jnt_data);
+      trans.actuatorToJointTorqueSensor(ref.act_data, ref.jnt_data);
+    }
+
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      for (std::size_t j = 0; j < trans.numJoints(); ++j)
+      {
+        EXPECT_DOUBLE_EQ(ref.jnt_vals[i][j], fused.jnt_vals[i][j]);
+      }
+    }
+  }
+}
+
+/**
+ * \brief Check that the fixed-size data overloads of a transmission yield the same results as their dynamically-sized
+ * counterparts.
+ * \tparam N Number of actuators and joints of the transmission.
+ */
+template <std::size_t N, class TransmissionType>
+inline void testFixedDataMaps(TransmissionType& trans)
+{
+  using namespace transmission_interface;
+
+  RandomDoubleGenerator generator(-1000.0, 1000.0);
+  for (std::size_t with_extras = 0; with_extras < 2; ++with_extras)
+  {
+    StateData fixed(N, N);
+    StateData ref(N, N);
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      const std::vector<double> act_vals = randomVector(N, generator);
+      const std::vector<double> jnt_vals = randomVector(N, generator);
+      std::copy(act_vals.begin(), act_vals.end(), fixed.act_vals[i].begin()); // In place, see testFusedStateMap
+      std::copy(jnt_vals.begin(), jnt_vals.end(), fixed.jnt_vals[i].begin());
+    }
+    ref.act_vals = fixed.act_vals;
+    ref.jnt_vals = fixed.jnt_vals;
+
+    if (!with_extras)
+    {
+      fixed.act_data.absolute_position.clear();
+      fixed.act_data.torque_sensor.clear();
+      ref.act_data.absolute_position.clear();
+      ref.act_data.torque_sensor.clear();
+    }
+
+    FixedActuatorData<N> fixed_act_data = toFixedActuatorData<N>(fixed.act_data);
+    FixedJointData<N>    fixed_jnt_data = toFixedJointData<N>(fixed.jnt_data);
+
+    // Joint to actuator maps. Actuator absolute position and torque sensor values are not written
+    trans.jointToActuatorPosition(fixed_jnt_data, fixed_act_data);
+    trans.jointToActuatorVelocity(fixed_jnt_data, fixed_act_data);
+    trans.jointToActuatorEffort(fixed_jnt_data, fixed_act_data);
+
+    trans.jointToActuatorPosition(ref.jnt_data, ref.act_data);
+    trans.jointToActuatorVelocity(ref.jnt_data, ref.act_data);
+    trans.jointToActuatorEffort(ref.jnt_data, ref.act_data);
+
+    // Actuator to joint maps, individual and fused
+    trans.actuatorToJointPosition(fixed_act_data, fixed_jnt_data);
+    trans.actuatorToJointVelocity(fixed_act_data, fixed_jnt_data);
+    trans.actuatorToJointEffort(fixed_act_data, fixed_jnt_data);
+    if (with_extras)
+    {
+      trans.actuatorToJointAbsolutePosition(fixed_act_data, fixed_jnt_data);
+      trans.actuatorToJointTorqueSensor(fixed_act_data, fixed_jnt_data);
+    }
+    trans.actuatorToJointState(fixed_act_data, fixed_jnt_data);
+
+    trans.actuatorToJointPosition(ref.act_data, ref.jnt_data);
+    trans.actuatorToJointVelocity(ref.act_data, ref.jnt_data);
+    trans.actuatorToJointEffort(ref.act_data, ref.jnt_data);
+    if (with_extras)
+    {
+      trans.actuatorToJointAbsolutePosition(ref.act_data, ref.jnt_data);
+      trans.actuatorToJointTorqueSensor(ref.act_data, ref.jnt_data);
+    }
+    trans.actuatorToJointState(ref.act_data, ref.jnt_data);
+
+    // Both paths share the same arithmetic, so results must be bitwise identical
+    EXPECT_EQ(ref.act_vals, fixed.act_vals);
+    EXPECT_EQ(ref.jnt_vals, fixed.jnt_vals);
+  }
+}
+
+#endif // TRANSMISSION_INTERFACE_STATE_MAP_UTILS_H
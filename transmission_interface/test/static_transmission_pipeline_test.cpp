@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <transmission_interface/differential_transmission.h>
+#include <transmission_interface/simple_transmission.h>
+#include <transmission_interface/static_transmission_pipeline.h>
+
+using std::vector;
+using namespace transmission_interface;
+
+typedef StaticTransmissionPipeline<SimpleTransmission, DifferentialTransmission> Pipeline;
+
+/// \brief Raw data of a single variable, and the pointers referring to it.
+struct RawData
+{
+  explicit RawData(std::size_t size, double value) : values(size, value)
+  {
+    for (std::size_t i = 0; i < size; ++i) {ptrs.push_back(&values[i]);}
+  }
+
+  vector<double>  values;
+  vector<double*> ptrs;
+};
+
+/// \brief Populate transmission interfaces with a simple and a differential transmission, as done by the loader.
+class StaticTransmissionPipelineTest : public ::testing::Test
+{
+public:
+  StaticTransmissionPipelineTest()
+    : simple_trans(50.0, 0.5),
+      diff_trans(false, vector<double>(2, 20.0), vector<double>(2, -2.0), vector<double>(2, 0.25))
+  {
+    infos.resize(2);
+    infos[0].name_ = "simple_trans";
+    infos[1].name_ = "diff_trans";
+
+    addTransmission(infos[0].name_, &simple_trans);
+    addTransmission(infos[1].name_, &diff_trans);
+
+    robot_transmissions.registerInterface(&act_to_jnt_state);
+    robot_transmissions.registerInterface(&jnt_to_act_pos_cmd);
+    robot_transmissions.registerInterface(&jnt_to_act_vel_cmd);
+    robot_transmissions.registerInterface(&jnt_to_act_eff_cmd);
+  }
+
+protected:
+  SimpleTransmission       simple_trans;
+  DifferentialTransmission diff_trans;
+  vector<TransmissionInfo> infos;
+
+  // Raw data of all transmissions. Holds one RawData per transmission and variable
+  vector<RawData> raw_data;
+
+  ActuatorToJointStateInterface    act_to_jnt_state;
+  JointToActuatorPositionInterface jnt_to_act_pos_cmd;
+  JointToActuatorVelocityInterface jnt_to_act_vel_cmd;
+  JointToActuatorEffortInterface   jnt_to_act_eff_cmd;
+  RobotTransmissions               robot_transmissions;
+
+  vector<double*>& newData(std::size_t size, double value)
+  {
+    raw_data.push_back(RawData(size, value));
+    return raw_data.back().ptrs;
+  }
+
+  void addTransmission(const std::string& name, Transmission* trans)
+  {
+    raw_data.reserve(32); // Pointers to raw data must remain valid
+    const std::size_t n_act = trans->numActuators();
+    const std::size_t n_jnt = trans->numJoints();
+
+    ActuatorData act_state;
+    JointData    jnt_state;
+    act_state.position = newData(n_act, 1.0);
+    act_state.velocity = newData(n_act, -2.0);
+    act_state.effort   = newData(n_act, 3.0);
+    jnt_state.position = newData(n_jnt, 0.0);
+    jnt_state.velocity = newData(n_jnt, 0.0);
+    jnt_state.effort   = newData(n_jnt, 0.0);
+    act_to_jnt_state.registerHandle(ActuatorToJointStateHandle(name, trans, act_state, jnt_state));
+
+    ActuatorData act_cmd;
+    JointData    jnt_cmd;
+    act_cmd.position = newData(n_act, 0.0);
+    jnt_cmd.position = newData(n_jnt, 0.5);
+    jnt_to_act_pos_cmd.registerHandle(JointToActuatorPositionHandle(name, trans, act_cmd, jnt_cmd));
+
+    act_cmd = ActuatorData();
+    jnt_cmd = JointData();
+    act_cmd.velocity = newData(n_act, 0.0);
+    jnt_cmd.velocity = newData(n_jnt, -1.5);
+    jnt_to_act_vel_cmd.registerHandle(JointToActuatorVelocityHandle(name, trans, act_cmd, jnt_cmd));
+
+    act_cmd = ActuatorData();
+    jnt_cmd = JointData();
+    act_cmd.effort = newData(n_act, 0.0);
+    jnt_cmd.effort = newData(n_jnt, 2.5);
+    jnt_to_act_eff_cmd.registerHandle(JointToActuatorEffortHandle(name, trans, act_cmd, jnt_cmd));
+  }
+
+  vector<double> getValues() const
+  {
+    vector<double> values;
+    for (std::size_t i = 0; i < raw_data.size(); ++i)
+    {
+      values.insert(values.end(), raw_data[i].values.begin(), raw_data[i].values.end());
+    }
+    return values;
+  }
+
+  void setValues(const vector<double>& values)
+  {
+    vector<double>::const_iterator it = values.begin();
+    for (std::size_t i = 0; i < raw_data.size(); ++i)
+    {
+      std::copy(it, it + raw_data[i].values.size(), raw_data[i].values.begin());
+      it += raw_data[i].values.size();
+    }
+  }
+};
+
+TEST_F(StaticTransmissionPipelineTest, Construction)
+{
+  Pipeline pipeline(infos, robot_transmissions);
+  EXPECT_EQ(2, pipeline.size());
+  EXPECT_EQ("simple_trans", pipeline.getName(0));
+  EXPECT_EQ("diff_trans",   pipeline.getName(1));
+
+  // Transmissions are copied
+  EXPECT_EQ(simple_trans.getActuatorReduction(), pipeline.getTransmission<0>().getActuatorReduction());
+  EXPECT_EQ(diff_trans.getJointOffset(),         pipeline.getTransmission<1>().getJointOffset());
+
+  // The differential is propagated with fixed-size data
+  EXPECT_EQ(0, FixedDataSize<SimpleTransmission>::value);
+  EXPECT_EQ(2, FixedDataSize<DifferentialTransmission>::value);
+}
+
+TEST_F(StaticTransmissionPipelineTest, ExceptionThrowing)
+{
+  // Wrong transmission count
+  {
+    vector<TransmissionInfo> bad_infos(1, infos.front());
+    EXPECT_THROW(Pipeline(bad_infos, robot_transmissions), TransmissionInterfaceException);
+  }
+
+  // Wrong transmission order
+  {
+    vector<TransmissionInfo> bad_infos(infos.rbegin(), infos.rend());
+    EXPECT_THROW(Pipeline(bad_infos, robot_transmissions), TransmissionInterfaceException);
+  }
+
+  // Unknown transmission
+  {
+    vector<TransmissionInfo> bad_infos = infos;
+    bad_infos.back().name_ = "unknown_trans";
+    EXPECT_THROW(Pipeline(bad_infos, robot_transmissions), TransmissionInterfaceException);
+  }
+
+  // No transmission interfaces
+  {
+    RobotTransmissions empty_robot_transmissions;
+    EXPECT_THROW(Pipeline(infos, empty_robot_transmissions), TransmissionInterfaceException);
+  }
+}
+
+TEST_F(StaticTransmissionPipelineTest, CompareWithRuntimeInterfaces)
+{
+  Pipeline pipeline(infos, robot_transmissions);
+  const vector<double> initial_values = getValues();
+
+  // Actuator to joint state
+  act_to_jnt_state.propagate();
+  const vector<double> runtime_state = getValues();
+  setValues(initial_values);
+  pipeline.actuatorToJointState();
+  EXPECT_EQ(runtime_state, getValues());
+  EXPECT_NE(initial_values, getValues());
+
+  // Joint to actuator commands
+  setValues(initial_values);
+  jnt_to_act_pos_cmd.propagate();
+  jnt_to_act_vel_cmd.propagate();
+  jnt_to_act_eff_cmd.propagate();
+  const vector<double> runtime_cmd = getValues();
+  setValues(initial_values);
+  pipeline.jointToActuatorPosition();
+  pipeline.jointToActuatorVelocity();
+  pipeline.jointToActuatorEffort();
+  EXPECT_EQ(runtime_cmd, getValues());
+  EXPECT_NE(initial_values, getValues());
+}
+
+TEST_F(StaticTransmissionPipelineTest, MissingMaps)
+{
+  // Transmissions exposing only their state to a robot without command interfaces
+  RobotTransmissions state_robot_transmissions;
+  state_robot_transmissions.registerInterface(&act_to_jnt_state);
+
+  Pipeline pipeline(infos, state_robot_transmissions);
+  const vector<double> initial_values = getValues();
+
+  pipeline.jointToActuatorPosition();
+  pipeline.jointToActuatorVelocity();
+  pipeline.jointToActuatorEffort();
+  EXPECT_EQ(initial_values, getValues());
+
+  pipeline.actuatorToJointState();
+  EXPECT_NE(initial_values, getValues());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,479 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/// \brief Benchmarks for the per-call cost of transmission maps and of transmission interface propagation.
+///
+/// Results of interest can be selected with the --benchmark_filter option, eg. --benchmark_filter=propagate
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <benchmark/benchmark.h>
+
+#include <transmission_interface/differential_transmission.h>
+#include <transmission_interface/four_bar_linkage_transmission.h>
+#include <transmission_interface/linear_transmission.h>
+#include <transmission_interface/parallel_propagator.h>
+#include <transmission_interface/simple_transmission.h>
+#include <transmission_interface/static_transmission_pipeline.h>
+#include <transmission_interface/transmission_interface.h>
+
+using namespace transmission_interface;
+using std::string;
+using std::vector;
+
+namespace reference
+{
+
+// Maps that divide by reduction ratios on every call, as implemented before reciprocal reductions were cached on
+// construction. Used as a baseline for the cached versions.
+
+struct SimpleTransmission
+{
+  SimpleTransmission(double reduction, double offset) : reduction_(reduction), jnt_offset_(offset) {}
+
+  std::size_t numActuators() const {return 1;}
+  std::size_t numJoints()    const {return 1;}
+
+  void actuatorToJointPosition(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    *jnt_data.position[0] = *act_data.position[0] / reduction_ + jnt_offset_;
+  }
+
+  void actuatorToJointVelocity(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    *jnt_data.velocity[0] = *act_data.velocity[0] / reduction_;
+  }
+
+  void jointToActuatorEffort(const JointData& jnt_data, ActuatorData& act_data)
+  {
+    *act_data.effort[0] = *jnt_data.effort[0] / reduction_;
+  }
+
+  double reduction_;
+  double jnt_offset_;
+};
+
+struct DifferentialTransmission
+{
+  DifferentialTransmission(const vector<double>& act_reduction,
+                           const vector<double>& jnt_reduction,
+                           const vector<double>& jnt_offset)
+    : act_reduction_(act_reduction), jnt_reduction_(jnt_reduction), jnt_offset_(jnt_offset) {}
+
+  std::size_t numActuators() const {return 2;}
+  std::size_t numJoints()    const {return 2;}
+
+  void actuatorToJointPosition(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *jnt_data.position[0] = (*act_data.position[0] / ar[0] + *act_data.position[1] / ar[1]) / (2.0 * jr[0]) + jnt_offset_[0];
+    *jnt_data.position[1] = (*act_data.position[0] / ar[0] - *act_data.position[1] / ar[1]) / (2.0 * jr[1]) + jnt_offset_[1];
+  }
+
+  void actuatorToJointVelocity(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *jnt_data.velocity[0] = (*act_data.velocity[0] / ar[0] + *act_data.velocity[1] / ar[1]) / (2.0 * jr[0]);
+    *jnt_data.velocity[1] = (*act_data.velocity[0] / ar[0] - *act_data.velocity[1] / ar[1]) / (2.0 * jr[1]);
+  }
+
+  void jointToActuatorEffort(const JointData& jnt_data, ActuatorData& act_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *act_data.effort[0] = (*jnt_data.effort[0] / jr[0] + *jnt_data.effort[1] / jr[1]) / (2.0 * ar[0]);
+    *act_data.effort[1] = (*jnt_data.effort[0] / jr[0] - *jnt_data.effort[1] / jr[1]) / (2.0 * ar[1]);
+  }
+
+  vector<double> act_reduction_;
+  vector<double> jnt_reduction_;
+  vector<double> jnt_offset_;
+};
+
+struct FourBarLinkageTransmission
+{
+  FourBarLinkageTransmission(const vector<double>& act_reduction,
+                             const vector<double>& jnt_reduction,
+                             const vector<double>& jnt_offset)
+    : act_reduction_(act_reduction), jnt_reduction_(jnt_reduction), jnt_offset_(jnt_offset) {}
+
+  std::size_t numActuators() const {return 2;}
+  std::size_t numJoints()    const {return 2;}
+
+  void actuatorToJointPosition(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *jnt_data.position[0] = *act_data.position[0] / (jr[0] * ar[0]) + jnt_offset_[0];
+    *jnt_data.position[1] = (*act_data.position[1] / ar[1] - *act_data.position[0] / (jr[0] * ar[0])) / jr[1]
+                            + jnt_offset_[1];
+  }
+
+  void actuatorToJointVelocity(const ActuatorData& act_data, JointData& jnt_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *jnt_data.velocity[0] = *act_data.velocity[0] / (jr[0] * ar[0]);
+    *jnt_data.velocity[1] = (*act_data.velocity[1] / ar[1] - *act_data.velocity[0] / (jr[0] * ar[0])) / jr[1];
+  }
+
+  void jointToActuatorEffort(const JointData& jnt_data, ActuatorData& act_data)
+  {
+    const vector<double>& ar = act_reduction_;
+    const vector<double>& jr = jnt_reduction_;
+    *act_data.effort[0] = *jnt_data.effort[0] / (ar[0] * jr[0]);
+    *act_data.effort[1] = (*jnt_data.effort[0] + *jnt_data.effort[1] / jr[1]) / ar[1];
+  }
+
+  vector<double> act_reduction_;
+  vector<double> jnt_reduction_;
+  vector<double> jnt_offset_;
+};
+
+} // namespace
+
+/// \brief Raw data of all variables of a transmission, and the data pointers referring to it.
+struct MapData
+{
+  MapData(std::size_t n_act, std::size_t n_jnt)
+    : act_vals(NUM_VARIABLES * n_act, 1.5), jnt_vals(NUM_VARIABLES * n_jnt, -0.5)
+  {
+    std::vector<double*>* act_vars[] = {&act_data.position, &act_data.velocity, &act_data.effort,
+                                        &act_data.absolute_position, &act_data.torque_sensor};
+    std::vector<double*>* jnt_vars[] = {&jnt_data.position, &jnt_data.velocity, &jnt_data.effort,
+                                        &jnt_data.absolute_position, &jnt_data.torque_sensor};
+    for (std::size_t var = 0; var < NUM_VARIABLES; ++var)
+    {
+      for (std::size_t i = 0; i < n_act; ++i) {act_vars[var]->push_back(&act_vals[var * n_act + i]);}
+      for (std::size_t i = 0; i < n_jnt; ++i) {jnt_vars[var]->push_back(&jnt_vals[var * n_jnt + i]);}
+    }
+  }
+
+  static const std::size_t NUM_VARIABLES = 5;
+
+  vector<double> act_vals;
+  vector<double> jnt_vals;
+  ActuatorData   act_data;
+  JointData      jnt_data;
+};
+
+// Transmission maps, as function objects that can be passed as template parameters
+
+struct ActuatorToJointPosition
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.actuatorToJointPosition(d.act_data, d.jnt_data);}
+};
+
+struct ActuatorToJointVelocity
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.actuatorToJointVelocity(d.act_data, d.jnt_data);}
+};
+
+struct ActuatorToJointEffort
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.actuatorToJointEffort(d.act_data, d.jnt_data);}
+};
+
+struct ActuatorToJointAbsolutePosition
+{
+  template <class T> void operator()(T& trans, MapData& d) const
+  {
+    trans.actuatorToJointAbsolutePosition(d.act_data, d.jnt_data);
+  }
+};
+
+struct ActuatorToJointTorqueSensor
+{
+  template <class T> void operator()(T& trans, MapData& d) const
+  {
+    trans.actuatorToJointTorqueSensor(d.act_data, d.jnt_data);
+  }
+};
+
+struct ActuatorToJointState
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.actuatorToJointState(d.act_data, d.jnt_data);}
+};
+
+struct JointToActuatorPosition
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.jointToActuatorPosition(d.jnt_data, d.act_data);}
+};
+
+struct JointToActuatorVelocity
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.jointToActuatorVelocity(d.jnt_data, d.act_data);}
+};
+
+struct JointToActuatorEffort
+{
+  template <class T> void operator()(T& trans, MapData& d) const {trans.jointToActuatorEffort(d.jnt_data, d.act_data);}
+};
+
+/// \brief Measure the cost of a single map call on a transmission whose type is known, ie. without virtual dispatch.
+template <class MapType, class TransmissionType>
+void transmissionMap(benchmark::State& state, TransmissionType trans)
+{
+  MapData data(trans.numActuators(), trans.numJoints());
+  MapType map;
+  for (auto _ : state)
+  {
+    map(trans, data);
+    benchmark::ClobberMemory();
+  }
+}
+
+template <class MapType, class TransmissionType>
+void registerMap(const std::string& name, const TransmissionType& trans)
+{
+  benchmark::RegisterBenchmark(name.c_str(), &transmissionMap<MapType, TransmissionType>, trans);
+}
+
+/// \brief Register benchmarks for all the maps of a transmission.
+template <class TransmissionType>
+void registerMapBenchmarks(const std::string& name, const TransmissionType& trans)
+{
+  registerMap<ActuatorToJointPosition>(name + "/actuatorToJointPosition", trans);
+  registerMap<ActuatorToJointVelocity>(name + "/actuatorToJointVelocity", trans);
+  registerMap<ActuatorToJointEffort>(name + "/actuatorToJointEffort", trans);
+  registerMap<ActuatorToJointAbsolutePosition>(name + "/actuatorToJointAbsolutePosition", trans);
+  registerMap<ActuatorToJointTorqueSensor>(name + "/actuatorToJointTorqueSensor", trans);
+  registerMap<ActuatorToJointState>(name + "/actuatorToJointState", trans);
+  registerMap<JointToActuatorPosition>(name + "/jointToActuatorPosition", trans);
+  registerMap<JointToActuatorVelocity>(name + "/jointToActuatorVelocity", trans);
+  registerMap<JointToActuatorEffort>(name + "/jointToActuatorEffort", trans);
+}
+
+/// \brief Register benchmarks for the division-based reference versions of the maps that use cached reductions.
+template <class ReferenceType>
+void registerReferenceBenchmarks(const std::string& name, const ReferenceType& ref_trans)
+{
+  registerMap<ActuatorToJointPosition>(name + "/actuatorToJointPosition/division_reference", ref_trans);
+  registerMap<ActuatorToJointVelocity>(name + "/actuatorToJointVelocity/division_reference", ref_trans);
+  registerMap<JointToActuatorEffort>(name + "/jointToActuatorEffort/division_reference", ref_trans);
+}
+
+vector<double> makeVector(double v0, double v1)
+{
+  vector<double> out(2);
+  out[0] = v0;
+  out[1] = v1;
+  return out;
+}
+
+/**
+ * \brief Set of transmissions, their raw data and the handles exposing them through a transmission interface.
+ *
+ * Transmission types alternate between simple, differential and four-bar linkage, so that propagation does not always
+ * dispatch to the same implementation.
+ */
+template <class InterfaceType, class HandleType>
+struct TransmissionSet
+{
+  explicit TransmissionSet(std::size_t size)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      boost::shared_ptr<Transmission> trans;
+      switch (i % 3)
+      {
+        case 0:
+          trans.reset(new SimpleTransmission(50.0, 0.5));
+          break;
+        case 1:
+          trans.reset(new DifferentialTransmission(false, makeVector(50.0, -30.0), makeVector(2.0, -3.0),
+                                                   makeVector(0.5, -0.5)));
+          break;
+        default:
+          trans.reset(new FourBarLinkageTransmission(makeVector(50.0, -30.0), makeVector(2.0, -3.0),
+                                                     makeVector(0.5, -0.5)));
+          break;
+      }
+      boost::shared_ptr<MapData> data(new MapData(trans->numActuators(), trans->numJoints()));
+
+      // Handles get position, velocity and effort data, as transmissions loaded from a robot description
+      ActuatorData act_data = data->act_data;
+      JointData    jnt_data = data->jnt_data;
+      act_data.absolute_position.clear();
+      act_data.torque_sensor.clear();
+      jnt_data.absolute_position.clear();
+      jnt_data.torque_sensor.clear();
+
+      std::ostringstream name;
+      name << "trans_" << i;
+      iface.registerHandle(HandleType(name.str(), trans.get(), act_data, jnt_data));
+
+      transmissions.push_back(trans);
+      map_data.push_back(data);
+    }
+  }
+
+  InterfaceType iface;
+  std::vector<boost::shared_ptr<Transmission> > transmissions;
+  std::vector<boost::shared_ptr<MapData> >      map_data;
+};
+
+/// \brief Measure the cost of propagating the maps of a transmission interface with \c state.range(0) handles.
+template <class InterfaceType, class HandleType>
+void propagate(benchmark::State& state)
+{
+  TransmissionSet<InterfaceType, HandleType> set(state.range(0));
+  for (auto _ : state)
+  {
+    set.iface.propagate();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(propagate, ActuatorToJointStateInterface,    ActuatorToJointStateHandle)
+  ->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagate, JointToActuatorPositionInterface, JointToActuatorPositionHandle)
+  ->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagate, JointToActuatorVelocityInterface, JointToActuatorVelocityHandle)
+  ->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagate, JointToActuatorEffortInterface,   JointToActuatorEffortHandle)
+  ->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+/**
+ * \brief Measure the cost of building a transmission interface with \c state.range(0) handles.
+ * \tparam Validate Whether handles are built from raw data, which is validated, or from already validated data.
+ */
+template <bool Validate>
+void registerHandles(benchmark::State& state)
+{
+  TransmissionSet<ActuatorToJointStateInterface, ActuatorToJointStateHandle> set(state.range(0));
+  const vector<string> names = set.iface.getNames();
+  vector<ActuatorToJointStateHandle> handles;
+  for (std::size_t i = 0; i < names.size(); ++i) {handles.push_back(set.iface.getHandle(names[i]));}
+
+  for (auto _ : state)
+  {
+    ActuatorToJointStateInterface iface;
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+      const ActuatorToJointStateHandle& h = handles[i];
+      if (Validate)
+      {
+        iface.registerHandle(ActuatorToJointStateHandle(h.getName(), h.getTransmission(), h.getActuatorData(),
+                                                        h.getJointData()));
+      }
+      else
+      {
+        iface.registerHandle(ActuatorToJointStateHandle(h.getName(), h.getData()));
+      }
+    }
+    benchmark::DoNotOptimize(iface);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(registerHandles, true)->Name("registerHandles/validated")->Arg(500)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(registerHandles, false)->Name("registerHandles/shared")->Arg(500)->Unit(benchmark::kMicrosecond);
+
+/**
+ * \brief Measure the cost of propagating a transmission interface with \c state.range(0) handles in parallel, with a
+ * pool of \c state.range(1) workers.
+ */
+template <class InterfaceType, class HandleType>
+void propagateParallel(benchmark::State& state)
+{
+  TransmissionSet<InterfaceType, HandleType> set(state.range(0));
+  set.iface.setPropagator(
+    boost::make_shared<ParallelPropagator<HandleType> >(boost::make_shared<PropagationWorkerPool>(state.range(1)), 1));
+  for (auto _ : state)
+  {
+    set.iface.propagate();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(propagateParallel, ActuatorToJointStateInterface, ActuatorToJointStateHandle)
+  ->Args({100, 1})->Args({1000, 1})->Args({1000, 3})->Args({10000, 3})->UseRealTime();
+
+/// \brief Measure the cost of propagating the state of a robot with a fixed transmission layout.
+template <bool Static>
+void fixedLayout(benchmark::State& state)
+{
+  typedef StaticTransmissionPipeline<SimpleTransmission, DifferentialTransmission, FourBarLinkageTransmission>
+    Pipeline;
+
+  TransmissionSet<ActuatorToJointStateInterface, ActuatorToJointStateHandle> set(Pipeline::size());
+  RobotTransmissions robot_transmissions;
+  robot_transmissions.registerInterface(&set.iface);
+
+  vector<TransmissionInfo> infos(Pipeline::size());
+  for (std::size_t i = 0; i < infos.size(); ++i) {infos[i].name_ = set.iface.getNames()[i];}
+  Pipeline pipeline(infos, robot_transmissions);
+
+  for (auto _ : state)
+  {
+    if (Static) {pipeline.actuatorToJointState();}
+    else        {set.iface.propagate();}
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(fixedLayout, false)->Name("fixedLayout/actuatorToJointState/runtime");
+BENCHMARK_TEMPLATE(fixedLayout, true)->Name("fixedLayout/actuatorToJointState/static");
+
+int main(int argc, char** argv)
+{
+  const vector<double> act_reduction = makeVector(50.0, -30.0);
+  const vector<double> jnt_reduction = makeVector( 2.0,  -3.0);
+  const vector<double> jnt_offset    = makeVector( 0.5,  -0.5);
+
+  // Three joints coupled to four actuators
+  vector<vector<double> > coupling(3, vector<double>(4, 0.0));
+  coupling[0][0] = 0.5;  coupling[0][1] =  0.5;
+  coupling[1][1] = 0.25; coupling[1][2] =  0.25;
+  coupling[2][0] = 0.1;  coupling[2][1] = -0.2; coupling[2][2] = 0.3; coupling[2][3] = -0.4;
+
+  registerMapBenchmarks("SimpleTransmission", SimpleTransmission(50.0, 0.5));
+  registerReferenceBenchmarks("SimpleTransmission", reference::SimpleTransmission(50.0, 0.5));
+
+  registerMapBenchmarks("DifferentialTransmission",
+                        DifferentialTransmission(false, act_reduction, jnt_reduction, jnt_offset));
+  registerReferenceBenchmarks("DifferentialTransmission",
+                              reference::DifferentialTransmission(act_reduction, jnt_reduction, jnt_offset));
+
+  registerMapBenchmarks("FourBarLinkageTransmission",
+                        FourBarLinkageTransmission(act_reduction, jnt_reduction, jnt_offset));
+  registerReferenceBenchmarks("FourBarLinkageTransmission",
+                              reference::FourBarLinkageTransmission(act_reduction, jnt_reduction, jnt_offset));
+
+  registerMapBenchmarks("LinearTransmission", LinearTransmission(coupling, vector<double>(3, 0.5)));
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <transmission_interface/transmission_info_cache.h>
+#include "read_file.h"
+
+using namespace transmission_interface;
+
+namespace
+{
+
+const std::string CACHE_PATH = "/tmp/transmission_interface_info_cache_test.bin";
+
+void expectEqual(const std::vector<TransmissionInfo>& expected, const std::vector<TransmissionInfo>& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_EQ(expected[i].name_, actual[i].name_);
+    EXPECT_EQ(expected[i].type_, actual[i].type_);
+
+    ASSERT_EQ(expected[i].joints_.size(), actual[i].joints_.size());
+    for (std::size_t j = 0; j < expected[i].joints_.size(); ++j)
+    {
+      const JointInfo& expected_jnt = expected[i].joints_[j];
+      const JointInfo& actual_jnt   = actual[i].joints_[j];
+      EXPECT_EQ(expected_jnt.name_, actual_jnt.name_);
+      EXPECT_EQ(expected_jnt.role_, actual_jnt.role_);
+      EXPECT_EQ(expected_jnt.hardware_interfaces_, actual_jnt.hardware_interfaces_);
+      EXPECT_EQ(getXmlElementString(expected_jnt), actual_jnt.xml_element_);
+      EXPECT_FALSE(actual_jnt.xml_element_ptr_);
+    }
+
+    ASSERT_EQ(expected[i].actuators_.size(), actual[i].actuators_.size());
+    for (std::size_t j = 0; j < expected[i].actuators_.size(); ++j)
+    {
+      const ActuatorInfo& expected_act = expected[i].actuators_[j];
+      const ActuatorInfo& actual_act   = actual[i].actuators_[j];
+      EXPECT_EQ(expected_act.name_, actual_act.name_);
+      EXPECT_EQ(expected_act.hardware_interfaces_, actual_act.hardware_interfaces_);
+      EXPECT_EQ(getXmlElementString(expected_act), actual_act.xml_element_);
+      EXPECT_FALSE(actual_act.xml_element_ptr_);
+    }
+  }
+}
+
+} // namespace
+
+TEST(TransmissionInfoCacheTest, RoundTrip)
+{
+  std::string urdf;
+  ASSERT_TRUE(readFile("test/urdf/parser_test_valid.urdf", urdf));
+  const std::vector<TransmissionInfo> infos = parseUrdf("test/urdf/parser_test_valid.urdf");
+  ASSERT_EQ(2, infos.size());
+
+  const uint64_t key = transmissionCacheKey(urdf);
+  ASSERT_TRUE(writeTransmissionCache(CACHE_PATH, key, infos));
+
+  std::vector<TransmissionInfo> cached_infos;
+  ASSERT_TRUE(readTransmissionCache(CACHE_PATH, key, cached_infos));
+  expectEqual(infos, cached_infos);
+
+  std::remove(CACHE_PATH.c_str());
+}
+
+TEST(TransmissionInfoCacheTest, EmptyTransmissions)
+{
+  const uint64_t key = transmissionCacheKey("<robot name=\"robot\"/>");
+  ASSERT_TRUE(writeTransmissionCache(CACHE_PATH, key, std::vector<TransmissionInfo>()));
+
+  std::vector<TransmissionInfo> cached_infos(1);
+  ASSERT_TRUE(readTransmissionCache(CACHE_PATH, key, cached_infos));
+  EXPECT_TRUE(cached_infos.empty());
+
+  std::remove(CACHE_PATH.c_str());
+}
+
+TEST(TransmissionInfoCacheTest, InvalidCache)
+{
+  const std::vector<TransmissionInfo> infos = parseUrdf("test/urdf/parser_test_valid.urdf");
+  ASSERT_EQ(2, infos.size());
+
+  std::string urdf;
+  ASSERT_TRUE(readFile("test/urdf/parser_test_valid.urdf", urdf));
+  const uint64_t key = transmissionCacheKey(urdf);
+  EXPECT_NE(key, transmissionCacheKey(urdf + " "));
+
+  std::vector<TransmissionInfo> cached_infos;
+
+  // Missing file
+  std::remove(CACHE_PATH.c_str());
+  EXPECT_FALSE(readTransmissionCache(CACHE_PATH, key, cached_infos));
+
+  // Unwritable file
+  EXPECT_FALSE(writeTransmissionCache("/nonexistent_directory/cache.bin", key, infos));
+
+  // Cache of a different robot description
+  ASSERT_TRUE(writeTransmissionCache(CACHE_PATH, key, infos));
+  EXPECT_FALSE(readTransmissionCache(CACHE_PATH, key + 1, cached_infos));
+  EXPECT_TRUE(cached_infos.empty());
+
+  // Truncated file
+  {
+    std::ifstream in(CACHE_PATH.c_str(), std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream out(CACHE_PATH.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), contents.size() / 2);
+  }
+  EXPECT_FALSE(readTransmissionCache(CACHE_PATH, key, cached_infos));
+  EXPECT_TRUE(cached_infos.empty());
+
+  std::remove(CACHE_PATH.c_str());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
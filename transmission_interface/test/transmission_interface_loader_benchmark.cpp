@@ -0,0 +1,257 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/// \brief Benchmarks for transmissions built by the transmission interface loader from a robot description.
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/scoped_ptr.hpp>
+#include <benchmark/benchmark.h>
+#include <hardware_interface/robot_hw.h>
+#include <hardware_interface/actuator_state_interface.h>
+#include <hardware_interface/actuator_command_interface.h>
+#include <transmission_interface/transmission_interface_loader.h>
+
+using namespace transmission_interface;
+
+/**
+ * \brief Robot description with \c size transmissions, alternating between simple and differential transmissions.
+ * \param size Number of transmissions.
+ * \param[out] act_names Names of the actuators referenced by the robot description.
+ */
+std::string makeRobotDescription(std::size_t size, std::vector<std::string>& act_names)
+{
+  const std::string hw_ifaces = "      <hardwareInterface>hardware_interface/PositionJointInterface</hardwareInterface>\n"
+                                "      <hardwareInterface>hardware_interface/VelocityJointInterface</hardwareInterface>\n"
+                                "      <hardwareInterface>hardware_interface/EffortJointInterface</hardwareInterface>\n";
+
+  std::ostringstream urdf;
+  urdf << "<?xml version=\"1.0\"?>\n<robot name=\"robot\">\n";
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const bool simple = (i % 2 == 0);
+    const std::size_t dim = simple ? 1 : 2;
+
+    urdf << "  <transmission name=\"trans_" << i << "\">\n";
+    urdf << "    <type>transmission_interface/" << (simple ? "SimpleTransmission" : "DifferentialTransmission")
+         << "</type>\n";
+    for (std::size_t j = 0; j < dim; ++j)
+    {
+      std::ostringstream act_name;
+      act_name << "actuator_" << act_names.size();
+      act_names.push_back(act_name.str());
+
+      urdf << "    <joint name=\"joint_" << i << "_" << j << "\">\n";
+      if (!simple) {urdf << "      <role>joint" << j + 1 << "</role>\n";}
+      urdf << hw_ifaces << "    </joint>\n";
+      urdf << "    <actuator name=\"" << act_name.str() << "\">\n";
+      if (!simple) {urdf << "      <role>actuator" << j + 1 << "</role>\n";}
+      urdf << "      <mechanicalReduction>50</mechanicalReduction>\n    </actuator>\n";
+    }
+    urdf << "  </transmission>\n";
+  }
+  urdf << "</robot>\n";
+  return urdf.str();
+}
+
+/// \brief Robot hardware exposing actuator state and command interfaces, and the transmissions loaded for it.
+class LoadedRobot
+{
+public:
+  explicit LoadedRobot(std::size_t size)
+  {
+    std::vector<std::string> act_names;
+    urdf_ = makeRobotDescription(size, act_names);
+
+    const std::size_t dim = act_names.size();
+    act_pos_.resize(dim, 1.0);
+    act_vel_.resize(dim, 1.0);
+    act_eff_.resize(dim, 1.0);
+    act_pos_cmd_.resize(dim, 0.0);
+    act_vel_cmd_.resize(dim, 0.0);
+    act_eff_cmd_.resize(dim, 0.0);
+
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+      hardware_interface::ActuatorStateHandle state_handle(act_names[i], &act_pos_[i], &act_vel_[i], &act_eff_[i]);
+      act_state_iface_.registerHandle(state_handle);
+      pos_act_iface_.registerHandle(hardware_interface::ActuatorHandle(state_handle, &act_pos_cmd_[i]));
+      vel_act_iface_.registerHandle(hardware_interface::ActuatorHandle(state_handle, &act_vel_cmd_[i]));
+      eff_act_iface_.registerHandle(hardware_interface::ActuatorHandle(state_handle, &act_eff_cmd_[i]));
+    }
+    robot_hw_.registerInterface(&act_state_iface_);
+    robot_hw_.registerInterface(&pos_act_iface_);
+    robot_hw_.registerInterface(&vel_act_iface_);
+    robot_hw_.registerInterface(&eff_act_iface_);
+  }
+
+  /**
+   * \brief Load transmissions. The loader owns the joint data and transmission interfaces, so it is kept alive.
+   * \param pool If set, transmissions are constructed concurrently by the threads of the pool.
+   */
+  bool load(PropagationWorkerPool* pool = 0)
+  {
+    loader_.reset(new TransmissionInterfaceLoader(&robot_hw_, &robot_transmissions_));
+    loader_->setParallelLoading(pool);
+    return loader_->load(urdf_);
+  }
+
+  RobotTransmissions& getRobotTransmissions() {return robot_transmissions_;}
+
+private:
+  std::string urdf_;
+  std::vector<double> act_pos_, act_vel_, act_eff_, act_pos_cmd_, act_vel_cmd_, act_eff_cmd_;
+  hardware_interface::ActuatorStateInterface    act_state_iface_;
+  hardware_interface::PositionActuatorInterface pos_act_iface_;
+  hardware_interface::VelocityActuatorInterface vel_act_iface_;
+  hardware_interface::EffortActuatorInterface   eff_act_iface_;
+
+  hardware_interface::RobotHW robot_hw_;
+  RobotTransmissions          robot_transmissions_;
+
+  boost::scoped_ptr<TransmissionInterfaceLoader> loader_;
+};
+
+/// \brief Measure the cost of loading \c state.range(0) transmissions from a robot description.
+void load(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    LoadedRobot* robot = new LoadedRobot(state.range(0));
+    state.ResumeTiming();
+
+    if (!robot->load()) {state.SkipWithError("Failed to load transmissions");}
+
+    state.PauseTiming();
+    delete robot; // Teardown is not measured
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(load)->Arg(1)->Arg(10)->Arg(100)->Arg(200)->Arg(500)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+/// \brief Measure the cost of loading \c state.range(0) transmissions, constructing them with \c state.range(1) workers.
+void loadParallel(benchmark::State& state)
+{
+  PropagationWorkerPool pool(state.range(1));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    LoadedRobot* robot = new LoadedRobot(state.range(0));
+    state.ResumeTiming();
+
+    if (!robot->load(&pool)) {state.SkipWithError("Failed to load transmissions");}
+
+    state.PauseTiming();
+    delete robot; // Teardown is not measured
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(loadParallel)->Args({100, 1})->Args({100, 3})->Args({1000, 1})->Args({1000, 3})
+                       ->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+/// \brief Membership query through the list of registered names, as the loader used to do.
+struct FindInNames
+{
+  static bool hasHandle(const hardware_interface::JointStateInterface& iface, const std::string& name)
+  {
+    const std::vector<std::string> names = iface.getNames();
+    return std::find(names.begin(), names.end(), name) != names.end();
+  }
+};
+
+/// \brief Membership query through the resource index.
+struct FindInIndex
+{
+  static bool hasHandle(const hardware_interface::JointStateInterface& iface, const std::string& name)
+  {
+    return iface.hasHandle(name);
+  }
+};
+
+/// \brief Measure the cost of checking whether a joint exists in an interface with \c state.range(0) joints.
+template <class Lookup>
+void hasResource(benchmark::State& state)
+{
+  const std::size_t size = state.range(0);
+  std::vector<std::string> names(size);
+  std::vector<double> data(size, 0.0);
+  hardware_interface::JointStateInterface iface;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    std::ostringstream os;
+    os << "joint_" << i;
+    names[i] = os.str();
+    iface.registerHandle(hardware_interface::JointStateHandle(names[i], &data[i], &data[i], &data[i]));
+  }
+
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(Lookup::hasHandle(iface, names[i]));
+    i = (i + 1) % size;
+  }
+}
+BENCHMARK_TEMPLATE(hasResource, FindInNames)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(hasResource, FindInIndex)->Arg(10)->Arg(100)->Arg(1000);
+
+/// \brief Measure the cost of propagating an interface of \c state.range(0) transmissions built by the loader.
+template <class InterfaceType>
+void propagateLoaded(benchmark::State& state)
+{
+  LoadedRobot robot(state.range(0));
+  if (!robot.load())
+  {
+    state.SkipWithError("Failed to load transmissions");
+    return;
+  }
+
+  InterfaceType* iface = robot.getRobotTransmissions().get<InterfaceType>();
+  if (!iface)
+  {
+    state.SkipWithError("Transmission interface not available");
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    iface->propagate();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(propagateLoaded, ActuatorToJointStateInterface)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagateLoaded, JointToActuatorPositionInterface)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagateLoaded, JointToActuatorVelocityInterface)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(propagateLoaded, JointToActuatorEffortInterface)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -27,6 +27,9 @@
 
 /// \author Adolfo Rodriguez Tsouroukdissian
 
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
 #include <gtest/gtest.h>
 #include <hardware_interface/robot_hw.h>
 #include <hardware_interface/actuator_state_interface.h>
@@ -66,6 +69,47 @@ TEST(IsPermutationTest, IsPermutation)
   EXPECT_FALSE(internal::is_permutation(d.begin(), d.end(), a.begin()));
 }
 
+TEST(RawJointDataMapTest, ContiguousStorage)
+{
+  RawJointDataMap raw_joint_data_map;
+  EXPECT_TRUE(raw_joint_data_map.empty());
+
+  // Reserved joints are stored contiguously, and their data is initialized to NaN
+  raw_joint_data_map.reserve(3);
+  EXPECT_EQ(3, raw_joint_data_map.available());
+  RawJointData& joint_b = raw_joint_data_map["b"];
+  RawJointData& joint_a = raw_joint_data_map["a"];
+  RawJointData& joint_c = raw_joint_data_map["c"];
+  EXPECT_EQ(3, raw_joint_data_map.size());
+  EXPECT_EQ(0, raw_joint_data_map.available());
+
+  EXPECT_EQ(joint_b.position + 1, joint_a.position);
+  EXPECT_EQ(joint_b.position + 2, joint_c.position);
+  EXPECT_EQ(joint_b.effort_cmd + 2, joint_c.effort_cmd);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(joint_b.position) % hardware_interface::internal::CACHE_LINE_SIZE);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(joint_b.velocity) % hardware_interface::internal::CACHE_LINE_SIZE);
+  EXPECT_NE(*joint_a.position, *joint_a.position); // NaN
+
+  // Existing joints are not added twice
+  EXPECT_EQ(joint_a.position, raw_joint_data_map["a"].position);
+  EXPECT_EQ(3, raw_joint_data_map.size());
+
+  // Growing the map does not move existing data
+  double* const pos_a = joint_a.position;
+  *pos_a = 1.0;
+  for (unsigned int i = 0; i < 100; ++i)
+  {
+    std::ostringstream os;
+    os << "joint_" << i;
+    raw_joint_data_map[os.str()];
+  }
+  EXPECT_EQ(103, raw_joint_data_map.size());
+  ASSERT_TRUE(raw_joint_data_map.end() != raw_joint_data_map.find("a"));
+  EXPECT_EQ(pos_a, raw_joint_data_map.find("a")->second.position);
+  EXPECT_EQ(1.0, *pos_a);
+  EXPECT_TRUE(raw_joint_data_map.end() == raw_joint_data_map.find("d"));
+}
+
 class TransmissionInterfaceLoaderTest : public ::testing::Test
 {
 public:
@@ -295,6 +339,15 @@ TEST_F(TransmissionInterfaceLoaderTest, SuccessfulLoad)
   ASSERT_TRUE(0 != jnt_to_act_vel_cmd);
   ASSERT_TRUE(0 != jnt_to_act_eff_cmd);
 
+  // Handles share the state and command data validated by the loader
+  const ValidatedTransmissionDataPtr state_data = act_to_jnt_state->getHandle(info_red.name_).getData();
+  const ValidatedTransmissionDataPtr pos_data   = jnt_to_act_pos_cmd->getHandle(info_red.name_).getData();
+  ASSERT_TRUE(state_data && pos_data);
+  EXPECT_EQ(state_data, act_to_jnt_state->getHandle(info_red.name_).getData());
+  EXPECT_NE(state_data, pos_data);
+  EXPECT_EQ(act_pos_cmd_iface->getHandle(info_red.actuators_.front().name_).getCommandPtr(),
+            pos_data->getActuatorData().position.front());
+
   // Actuator handles
   ASSERT_NO_THROW(act_pos_cmd_iface->getHandle(info_red.actuators_.front().name_));
   ASSERT_NO_THROW(act_vel_cmd_iface->getHandle(info_red.actuators_.front().name_));
@@ -390,6 +443,99 @@ TEST_F(TransmissionInterfaceLoaderTest, SuccessfulLoad)
   EXPECT_NEAR(1.0, act_eff_cmd_handle_diff2.getEffort(), EPS);
 }
 
+TEST_F(TransmissionInterfaceLoaderTest, ParallelLoad)
+{
+  std::vector<TransmissionInfo> infos = parseUrdf("test/urdf/transmission_interface_loader_valid.urdf");
+  ASSERT_EQ(2, infos.size());
+
+  PropagationWorkerPool pool(2);
+  TransmissionInterfaceLoader trans_iface_loader(&robot_hw, &robot_transmissions);
+  trans_iface_loader.setParallelLoading(&pool);
+  ASSERT_TRUE(trans_iface_loader.load(infos));
+  EXPECT_EQ(3, trans_iface_loader.getData()->raw_joint_data_map.size());
+  EXPECT_EQ(6, trans_iface_loader.getData()->transmission_data.size());
+
+  // Same results as serial loading
+  using namespace hardware_interface;
+  ActuatorToJointStateInterface* act_to_jnt_state = robot_transmissions.get<ActuatorToJointStateInterface>();
+  PositionJointInterface*        pos_jnt_iface    = robot_hw.get<PositionJointInterface>();
+  ASSERT_TRUE(0 != act_to_jnt_state);
+  ASSERT_TRUE(0 != pos_jnt_iface);
+  EXPECT_EQ(2, act_to_jnt_state->getNames().size());
+  EXPECT_EQ(3, pos_jnt_iface->getNames().size());
+
+  act_pos.assign(3, 50.0);
+  act_to_jnt_state->propagate();
+  EXPECT_NEAR(1.5, pos_jnt_iface->getHandle(infos.front().joints_.front().name_).getPosition(), EPS);
+  EXPECT_NEAR(1.5, pos_jnt_iface->getHandle(infos.back().joints_.front().name_).getPosition(),  EPS);
+  EXPECT_NEAR(0.5, pos_jnt_iface->getHandle(infos.back().joints_.back().name_).getPosition(),   EPS);
+}
+
+TEST_F(TransmissionInterfaceLoaderTest, ParallelLoadFailure)
+{
+  std::vector<TransmissionInfo> infos = parseUrdf("test/urdf/transmission_interface_loader_valid.urdf");
+  ASSERT_EQ(2, infos.size());
+  infos.push_back(infos.front());
+  infos[1].type_ = "unsupported/transmission_type";
+
+  // Transmissions preceding the failing one are loaded, as in serial loading
+  PropagationWorkerPool pool(2);
+  TransmissionInterfaceLoader trans_iface_loader(&robot_hw, &robot_transmissions);
+  trans_iface_loader.setParallelLoading(&pool);
+  ASSERT_FALSE(trans_iface_loader.load(infos));
+
+  ActuatorToJointStateInterface* act_to_jnt_state = robot_transmissions.get<ActuatorToJointStateInterface>();
+  ASSERT_TRUE(0 != act_to_jnt_state);
+  ASSERT_EQ(1, act_to_jnt_state->getNames().size());
+  EXPECT_EQ(infos.front().name_, act_to_jnt_state->getNames().front());
+}
+
+TEST_F(TransmissionInterfaceLoaderTest, CacheMiss)
+{
+  const std::string urdf_filename = "test/urdf/transmission_interface_loader_valid.urdf";
+  const std::string cache_path    = "/tmp/transmission_interface_loader_cache_miss_test.bin";
+  std::string urdf;
+  ASSERT_TRUE(readFile(urdf_filename, urdf));
+  std::remove(cache_path.c_str());
+
+  // The robot description is parsed, and the cache file written
+  TransmissionInterfaceLoader trans_iface_loader(&robot_hw, &robot_transmissions);
+  trans_iface_loader.setCacheFile(cache_path);
+  ASSERT_TRUE(trans_iface_loader.load(urdf));
+  EXPECT_EQ(3, trans_iface_loader.getData()->raw_joint_data_map.size());
+
+  std::vector<TransmissionInfo> cached_infos;
+  ASSERT_TRUE(readTransmissionCache(cache_path, transmissionCacheKey(urdf), cached_infos));
+  EXPECT_EQ(2, cached_infos.size());
+
+  std::remove(cache_path.c_str());
+}
+
+TEST_F(TransmissionInterfaceLoaderTest, CacheHit)
+{
+  const std::string urdf_filename = "test/urdf/transmission_interface_loader_valid.urdf";
+  const std::string cache_path    = "/tmp/transmission_interface_loader_cache_hit_test.bin";
+  std::string urdf;
+  ASSERT_TRUE(readFile(urdf_filename, urdf));
+
+  // Rename a cached transmission to tell cached from parsed transmissions apart
+  std::vector<TransmissionInfo> infos = parseUrdf(urdf_filename);
+  ASSERT_EQ(2, infos.size());
+  infos.front().name_ = "cached_trans";
+  ASSERT_TRUE(writeTransmissionCache(cache_path, transmissionCacheKey(urdf), infos));
+
+  TransmissionInterfaceLoader trans_iface_loader(&robot_hw, &robot_transmissions);
+  trans_iface_loader.setCacheFile(cache_path);
+  ASSERT_TRUE(trans_iface_loader.load(urdf));
+
+  ActuatorToJointStateInterface* act_to_jnt_state = robot_transmissions.get<ActuatorToJointStateInterface>();
+  ASSERT_TRUE(0 != act_to_jnt_state);
+  const std::vector<std::string> names = act_to_jnt_state->getNames();
+  EXPECT_TRUE(std::find(names.begin(), names.end(), "cached_trans") != names.end());
+
+  std::remove(cache_path.c_str());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -27,11 +27,17 @@
 
 /// \author Adolfo Rodriguez Tsouroukdissian
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include <boost/make_shared.hpp>
+
+#include <transmission_interface/parallel_propagator.h>
 #include <transmission_interface/simple_transmission.h>
 #include <transmission_interface/transmission_interface.h>
 
@@ -149,6 +155,40 @@ TEST(HandlePreconditionsTest, BadSize)
     j_data.effort = bad_size_vector;
     EXPECT_THROW(DummyHandle("trans", &trans, a_data, j_data), TransmissionInterfaceException);
   }
+  {
+    vector<double*> good_vec(1, &val);
+    ActuatorData a_data;
+    JointData    j_data;
+    a_data.position      = good_vec;
+    j_data.position      = good_vec;
+    a_data.torque_sensor = bad_size_vector;
+    EXPECT_THROW(DummyHandle("trans", &trans, a_data, j_data), TransmissionInterfaceException);
+  }
+}
+
+TEST(HandlePreconditionsTest, SharedData)
+{
+  double a_val = 1.0;
+  double j_val = 0.0;
+  ActuatorData a_data;
+  JointData    j_data;
+  a_data.position = vector<double*>(1, &a_val);
+  j_data.position = vector<double*>(1, &j_val);
+  SimpleTransmission trans(10.0);
+
+  // Handles built from validated data share it
+  ActuatorToJointPositionHandle handle("trans", &trans, a_data, j_data);
+  ActuatorToJointPositionHandle shared_handle("trans", handle.getData());
+  EXPECT_EQ(handle.getData(), shared_handle.getData());
+  EXPECT_EQ(&trans, shared_handle.getTransmission());
+  EXPECT_EQ(j_data.position, shared_handle.getJointData().position);
+
+  shared_handle.propagate();
+  EXPECT_NEAR(0.1, j_val, EPS);
+
+  // Validation errors are reported when creating the data
+  EXPECT_THROW(ValidatedTransmissionData(0, a_data, j_data), TransmissionInterfaceException);
+  EXPECT_THROW(ActuatorToJointPositionHandle("trans", ValidatedTransmissionDataPtr()), TransmissionInterfaceException);
 }
 
 TEST(HandlePreconditionsTest, EmptyData)
@@ -593,6 +633,55 @@ TEST_F(InterfaceWhiteBoxTest, StateMap)
 }
 
 
+TEST_F(InterfaceWhiteBoxTest, RegistrationChanges)
+{
+  ActuatorData a_curr_data[2];
+  JointData    j_curr_data[2];
+  a_curr_data[0].position = vector<double*>(1, &a_curr_pos[0]);
+  j_curr_data[0].position = vector<double*>(1, &j_curr_pos[0]);
+  a_curr_data[1].position = vector<double*>(1, &a_curr_pos[1]);
+  j_curr_data[1].position = vector<double*>(1, &j_curr_pos[1]);
+
+  a_curr_pos[0] = 1.0;
+  a_curr_pos[1] = 1.0;
+
+  // Handles registered after propagating are also propagated
+  ActuatorToJointPositionInterface to_jnt_pos;
+  to_jnt_pos.registerHandle(ActuatorToJointPositionHandle("trans_2", &trans2, a_curr_data[1], j_curr_data[1]));
+  to_jnt_pos.propagate();
+  EXPECT_NEAR(0.0, j_curr_pos[0], EPS);
+  EXPECT_NEAR(0.9, j_curr_pos[1], EPS);
+
+  to_jnt_pos.registerHandle(ActuatorToJointPositionHandle("trans_1", &trans1, a_curr_data[0], j_curr_data[0]));
+  to_jnt_pos.propagate();
+  EXPECT_NEAR(1.1, j_curr_pos[0], EPS);
+
+  // Replaced handles are propagated with their new data
+  to_jnt_pos.registerHandle(ActuatorToJointPositionHandle("trans_2", &trans1, a_curr_data[1], j_curr_data[1]));
+  to_jnt_pos.propagate();
+  EXPECT_NEAR(1.1, j_curr_pos[1], EPS);
+
+  // Copies propagate their own handles
+  ActuatorToJointPositionInterface to_jnt_pos_copy(to_jnt_pos);
+  to_jnt_pos = ActuatorToJointPositionInterface();
+  j_curr_pos[0] = 0.0;
+  j_curr_pos[1] = 0.0;
+  to_jnt_pos_copy.propagate();
+  EXPECT_NEAR(1.1, j_curr_pos[0], EPS);
+  EXPECT_NEAR(1.1, j_curr_pos[1], EPS);
+
+  // Handles registered through a base class pointer are also propagated, as when combining interfaces
+  ActuatorToJointPositionInterface to_jnt_pos_combined;
+  std::vector<hardware_interface::ResourceManager<ActuatorToJointPositionHandle>*> managers;
+  managers.push_back(&to_jnt_pos_copy);
+  hardware_interface::ResourceManager<ActuatorToJointPositionHandle>::concatManagers(managers, &to_jnt_pos_combined);
+  j_curr_pos[0] = 0.0;
+  j_curr_pos[1] = 0.0;
+  to_jnt_pos_combined.propagate();
+  EXPECT_NEAR(1.1, j_curr_pos[0], EPS);
+  EXPECT_NEAR(1.1, j_curr_pos[1], EPS);
+}
+
 class AccessorTest : public TransmissionInterfaceSetup {};
 
 TEST_F(AccessorTest, AccessorValidation)
@@ -630,6 +719,164 @@ TEST_F(AccessorTest, AccessorValidation)
   catch(const TransmissionInterfaceException& e) {ROS_ERROR_STREAM(e.what());}
 }
 
+class ParallelPropagationTest : public ::testing::Test
+{
+public:
+  ParallelPropagationTest()
+    : size(100),
+      a_pos(size + 1),
+      j_pos(size + 1),
+      trans(10.0, 1.0),
+      pool(new PropagationWorkerPool(3))
+  {
+    for (std::size_t i = 0; i < a_pos.size(); ++i) {a_pos[i] = static_cast<double>(i);}
+  }
+
+protected:
+  typedef ParallelPropagator<ActuatorToJointPositionHandle> Propagator;
+
+  std::size_t    size;
+  vector<double> a_pos;
+  vector<double> j_pos;
+
+  SimpleTransmission trans;
+  boost::shared_ptr<PropagationWorkerPool> pool;
+
+  static string handleName(std::size_t i)
+  {
+    std::ostringstream name;
+    name << "trans_" << std::setw(3) << std::setfill('0') << i;
+    return name.str();
+  }
+
+  ActuatorToJointPositionHandle makeHandle(std::size_t i, double* act_pos, double* jnt_pos)
+  {
+    ActuatorData a_data;
+    JointData    j_data;
+    a_data.position = vector<double*>(1, act_pos);
+    j_data.position = vector<double*>(1, jnt_pos);
+    return ActuatorToJointPositionHandle(handleName(i), &trans, a_data, j_data);
+  }
+};
+
+TEST_F(ParallelPropagationTest, IndependentHandles)
+{
+  ActuatorToJointPositionInterface iface;
+  for (std::size_t i = 0; i < size; ++i) {iface.registerHandle(makeHandle(i, &a_pos[i], &j_pos[i]));}
+
+  // Below threshold
+  boost::shared_ptr<Propagator> propagator = boost::make_shared<Propagator>(pool, size + 1);
+  iface.setPropagator(propagator);
+  EXPECT_EQ(0, propagator->getNumChunks());
+
+  // Above threshold, one chunk per thread
+  propagator = boost::make_shared<Propagator>(pool, size);
+  iface.setPropagator(propagator);
+  EXPECT_EQ(pool->concurrency(), propagator->getNumChunks());
+
+  for (int run = 0; run < 100; ++run)
+  {
+    std::fill(j_pos.begin(), j_pos.end(), 0.0);
+    iface.propagate();
+    for (std::size_t i = 0; i < size; ++i) {ASSERT_NEAR(0.1 * a_pos[i] + 1.0, j_pos[i], EPS);}
+  }
+
+  // Detached
+  iface.setPropagator(boost::shared_ptr<Propagator>());
+  EXPECT_FALSE(iface.getPropagator());
+  std::fill(j_pos.begin(), j_pos.end(), 0.0);
+  iface.propagate();
+  for (std::size_t i = 0; i < size; ++i) {ASSERT_NEAR(0.1 * a_pos[i] + 1.0, j_pos[i], EPS);}
+}
+
+TEST_F(ParallelPropagationTest, DependentHandles)
+{
+  // Each handle reads the output of the previous one, so all handles must be propagated in order by a single thread
+  ActuatorToJointPositionInterface iface;
+  boost::shared_ptr<Propagator> propagator = boost::make_shared<Propagator>(pool, 1);
+  iface.setPropagator(propagator);
+  for (std::size_t i = 0; i < size; ++i) {iface.registerHandle(makeHandle(i, &a_pos[i], &a_pos[i + 1]));}
+  EXPECT_EQ(0, propagator->getNumChunks());
+
+  a_pos[0] = 0.0;
+  iface.propagate();
+  double expected = 0.0;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    expected = 0.1 * expected + 1.0;
+    ASSERT_NEAR(expected, a_pos[i + 1], EPS);
+  }
+
+  // Break the chain in two halves by replacing a handle
+  const std::size_t half = size / 2;
+  iface.registerHandle(makeHandle(half, &j_pos[0], &a_pos[half + 1]));
+  EXPECT_EQ(2, propagator->getNumChunks());
+
+  a_pos[0] = 0.0;
+  j_pos[0] = 0.0;
+  iface.propagate();
+  expected = 0.0;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    expected = 0.1 * (i == half ? j_pos[0] : expected) + 1.0;
+    ASSERT_NEAR(expected, a_pos[i + 1], EPS);
+  }
+}
+
+TEST_F(ParallelPropagationTest, SharedPool)
+{
+  // Interfaces propagated one after the other can share a pool
+  ActuatorToJointPositionInterface to_jnt;
+  JointToActuatorPositionInterface to_act;
+  vector<double> a_cmd(size, 0.0);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    to_jnt.registerHandle(makeHandle(i, &a_pos[i], &j_pos[i]));
+
+    ActuatorData a_data;
+    JointData    j_data;
+    a_data.position = vector<double*>(1, &a_cmd[i]);
+    j_data.position = vector<double*>(1, &j_pos[i]);
+    to_act.registerHandle(JointToActuatorPositionHandle(handleName(i), &trans, a_data, j_data));
+  }
+  to_jnt.setPropagator(boost::make_shared<Propagator>(pool, 1));
+  to_act.setPropagator(boost::make_shared<ParallelPropagator<JointToActuatorPositionHandle> >(pool, 1));
+
+  to_jnt.propagate();
+  to_act.propagate();
+  for (std::size_t i = 0; i < size; ++i) {ASSERT_NEAR(a_pos[i], a_cmd[i], EPS);}
+}
+
+void countTask(void* context, std::size_t task)
+{
+  ++(*static_cast<vector<int>*>(context))[task];
+}
+
+TEST(PropagationWorkerPoolTest, RepeatedRuns)
+{
+  // Each task is executed exactly once per run, whether idle workers sleep or busy-wait
+  const bool busy_wait[] = {false, true};
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    PropagationWorkerPool pool(2, busy_wait[i]);
+    vector<int> counts(8, 0);
+    const int runs = 1000;
+    for (int run = 0; run < runs; ++run) {pool.run(counts.size(), &countTask, &counts);}
+    for (std::size_t task = 0; task < counts.size(); ++task) {EXPECT_EQ(runs, counts[task]);}
+  }
+}
+
+TEST(PropagationWorkerPoolTest, RealtimeWorkers)
+{
+  // Workers run tasks whether or not their CPU and priority could be set
+  PropagationWorkerPool pool(vector<int>(2, 0), false, 1);
+  EXPECT_EQ(2, pool.numWorkers());
+  vector<int> counts(8, 0);
+  const int runs = 100;
+  for (int run = 0; run < runs; ++run) {pool.run(counts.size(), &countTask, &counts);}
+  for (std::size_t task = 0; task < counts.size(); ++task) {EXPECT_EQ(runs, counts[task]);}
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
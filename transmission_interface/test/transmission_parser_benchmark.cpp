@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026, PAL Robotics S.L.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//   * Neither the name of PAL Robotics S.L. nor the names of its
+//     contributors may be used to endorse or promote products derived from
+//     this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//////////////////////////////////////////////////////////////////////////////
+
+/// \brief Benchmarks for parsing transmissions from large robot descriptions.
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <transmission_interface/transmission_loader.h>
+#include <transmission_interface/transmission_parser.h>
+
+using namespace transmission_interface;
+
+/**
+ * \brief Robot description with \c size links and simple transmissions.
+ *
+ * Every link has a visual with an inlined mesh of \c mesh_size vertices, as found in xacro output with embedded
+ * geometry, so most of the description is not related to transmissions.
+ */
+std::string makeRobotDescription(std::size_t size, std::size_t mesh_size = 100)
+{
+  std::ostringstream mesh;
+  for (std::size_t i = 0; i < mesh_size; ++i) {mesh << "0.125 -0.25 0.5 ";}
+
+  std::ostringstream urdf;
+  urdf << "<?xml version=\"1.0\"?>\n<robot name=\"robot\">\n";
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    urdf << "  <link name=\"link_" << i << "\">\n"
+         << "    <visual>\n"
+         << "      <origin xyz=\"0 0 0\" rpy=\"0 0 0\"/>\n"
+         << "      <geometry><mesh><vertices>" << mesh.str() << "</vertices></mesh></geometry>\n"
+         << "    </visual>\n"
+         << "  </link>\n";
+  }
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    urdf << "  <transmission name=\"trans_" << i << "\">\n"
+         << "    <type>transmission_interface/SimpleTransmission</type>\n"
+         << "    <joint name=\"joint_" << i << "\">\n"
+         << "      <offset>0.5</offset>\n"
+         << "      <hardwareInterface>hardware_interface/EffortJointInterface</hardwareInterface>\n"
+         << "    </joint>\n"
+         << "    <actuator name=\"actuator_" << i << "\">\n"
+         << "      <mechanicalReduction>50</mechanicalReduction>\n"
+         << "    </actuator>\n"
+         << "  </transmission>\n";
+  }
+  urdf << "</robot>\n";
+  return urdf.str();
+}
+
+/// \brief Measure the cost of parsing the transmissions of a robot description with \c state.range(0) of them.
+void parse(benchmark::State& state)
+{
+  const std::string urdf = makeRobotDescription(state.range(0));
+  for (auto _ : state)
+  {
+    std::vector<TransmissionInfo> infos;
+    if (!TransmissionParser::parse(urdf, infos)) {state.SkipWithError("Failed to parse transmissions");}
+    benchmark::DoNotOptimize(infos.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * urdf.size());
+}
+BENCHMARK(parse)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+/// \brief Reference cost of building a DOM of the whole robot description, as needed before transmission parsing.
+void parseDomReference(benchmark::State& state)
+{
+  const std::string urdf = makeRobotDescription(state.range(0));
+  for (auto _ : state)
+  {
+    TiXmlDocument doc;
+    doc.Parse(urdf.c_str());
+    benchmark::DoNotOptimize(doc.RootElement());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * urdf.size());
+}
+BENCHMARK(parseDomReference)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+/// \brief Exposes the XML element accessors available to transmission loaders.
+struct XmlElementLoader : public TransmissionLoader
+{
+  TransmissionPtr load(const TransmissionInfo&) {return TransmissionPtr();}
+
+  using TransmissionLoader::XmlElementConstPtr;
+  using TransmissionLoader::loadXmlElement;
+};
+
+/// \brief Joint element is re-parsed from its string representation.
+struct FromString
+{
+  static XmlElementLoader::XmlElementConstPtr load(const JointInfo& info)
+  {
+    return XmlElementLoader::loadXmlElement(XmlElementLoader::XmlElementConstPtr(), info.xml_element_);
+  }
+};
+
+/// \brief Joint element pre-parsed by the transmission parser is used.
+struct FromParsedElement
+{
+  static XmlElementLoader::XmlElementConstPtr load(const JointInfo& info)
+  {
+    return XmlElementLoader::loadXmlElement(info);
+  }
+};
+
+/// \brief Measure the cost of getting the XML elements of the joints of \c state.range(0) transmissions.
+template <class Source>
+void loadJointElements(benchmark::State& state)
+{
+  std::vector<TransmissionInfo> infos;
+  if (!TransmissionParser::parse(makeRobotDescription(state.range(0), 0), infos))
+  {
+    state.SkipWithError("Failed to parse transmissions");
+    return;
+  }
+  for (std::size_t i = 0; i < infos.size(); ++i)
+  {
+    JointInfo& joint = infos[i].joints_.front();
+    joint.xml_element_ = getXmlElementString(joint); // As read from a transmission info cache
+  }
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < infos.size(); ++i)
+    {
+      const XmlElementLoader::XmlElementConstPtr element = Source::load(infos[i].joints_.front());
+      benchmark::DoNotOptimize(element->Attribute("name"));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(loadJointElements, FromString)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(loadJointElements, FromParsedElement)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
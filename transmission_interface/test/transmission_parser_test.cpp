@@ -90,8 +90,8 @@ TEST(TransmissionParserTest, SuccessfulParse)
     ASSERT_EQ(2, info.actuators_.size());
     EXPECT_EQ("foo_actuator",info.actuators_.front().name_);
     EXPECT_EQ("bar_actuator",info.actuators_.back().name_);
-    EXPECT_FALSE(info.actuators_.front().xml_element_.empty());
-    EXPECT_FALSE(info.actuators_.back().xml_element_.empty());
+    EXPECT_FALSE(getXmlElementString(info.actuators_.front()).empty());
+    EXPECT_FALSE(getXmlElementString(info.actuators_.back()).empty());
 
     ASSERT_EQ(2, info.joints_.size());
     EXPECT_EQ("foo_joint",info.joints_.front().name_);
@@ -104,8 +104,15 @@ TEST(TransmissionParserTest, SuccessfulParse)
     ASSERT_EQ(1, info.joints_[1].hardware_interfaces_.size());
     EXPECT_EQ("hardware_interface/EffortJointInterface", info.joints_[1].hardware_interfaces_[0]);
 
-    EXPECT_FALSE(info.joints_.front().xml_element_.empty());
-    EXPECT_FALSE(info.joints_.back().xml_element_.empty());
+    EXPECT_FALSE(getXmlElementString(info.joints_.front()).empty());
+    EXPECT_FALSE(getXmlElementString(info.joints_.back()).empty());
+
+    // Pre-parsed elements outlive the parser and the URDF, and are not serialized
+    EXPECT_TRUE(info.joints_.front().xml_element_.empty());
+    ASSERT_TRUE(info.joints_.front().xml_element_ptr_);
+    ASSERT_TRUE(info.actuators_.back().xml_element_ptr_);
+    EXPECT_STREQ("foo_joint", info.joints_.front().xml_element_ptr_->Attribute("name"));
+    EXPECT_STREQ("bar_actuator", info.actuators_.back().xml_element_ptr_->Attribute("name"));
   }
 
   // Simple transmission
@@ -116,20 +123,64 @@ TEST(TransmissionParserTest, SuccessfulParse)
 
     ASSERT_EQ(1, info.actuators_.size());
     EXPECT_EQ("baz_actuator",info.actuators_.front().name_);
-    EXPECT_FALSE(info.actuators_.front().xml_element_.empty());
+    EXPECT_FALSE(getXmlElementString(info.actuators_.front()).empty());
 
     ASSERT_EQ(1, info.actuators_.front().hardware_interfaces_.size());
     EXPECT_EQ("hardware_interface/PositionActuatorInterface", info.actuators_.front().hardware_interfaces_.front());
 
     ASSERT_EQ(1, info.joints_.size());
     EXPECT_EQ("baz_joint",info.joints_.front().name_);
-    EXPECT_FALSE(info.joints_.front().xml_element_.empty());
+    EXPECT_FALSE(getXmlElementString(info.joints_.front()).empty());
 
     ASSERT_EQ(1, info.joints_.front().hardware_interfaces_.size());
     EXPECT_EQ("hardware_interface/PositionJointInterface", info.joints_.front().hardware_interfaces_.front());
   }
 }
 
+TEST(TransmissionParserTest, MalformedDescriptions)
+{
+  TransmissionParser parser;
+  std::vector<TransmissionInfo> infos;
+
+  EXPECT_FALSE(parser.parse("", infos));
+  EXPECT_FALSE(parser.parse("<robot name=\"robot\">", infos));                        // Unterminated root
+  EXPECT_FALSE(parser.parse("<robot name=\"robot\"><link></robot>", infos));           // Mismatched tags
+  EXPECT_FALSE(parser.parse("<robot name=\"robot></robot>", infos));                   // Unterminated attribute
+  EXPECT_FALSE(parser.parse("<robot name=\"robot\"><!-- </robot>", infos));            // Unterminated comment
+  EXPECT_FALSE(parser.parse("<robot name=\"robot\"/><robot name=\"robot\"/>", infos)); // Two root elements
+  EXPECT_TRUE(infos.empty());
+}
+
+TEST(TransmissionParserTest, SkippedMarkup)
+{
+  // Transmissions inside comments, CDATA sections or other elements are not parsed, and markup characters inside
+  // attribute values do not confuse the parser
+  const std::string transmission =
+    "<transmission name=\"simple_trans\">"
+    "<type>transmission_interface/SimpleTransmission</type>"
+    "<joint name=\"foo_joint\"><hardwareInterface>hardware_interface/EffortJointInterface</hardwareInterface></joint>"
+    "<actuator name=\"foo_actuator\"><mechanicalReduction>50</mechanicalReduction></actuator>"
+    "</transmission>";
+  const std::string urdf =
+    "<?xml version=\"1.0\"?>\n"
+    "<!DOCTYPE robot [ <!ENTITY foo \"bar\"> ]>\n"
+    "<robot name=\"robot\">\n"
+    "  <!-- " + transmission + " -->\n"
+    "  <link name=\"a>b\"><visual><![CDATA[ " + transmission + " ]]></visual></link>\n"
+    "  <gazebo>" + transmission + "</gazebo>\n"
+    "  <link name=\"c\"/>\n"
+    "  " + transmission + "\n"
+    "</robot>\n";
+
+  TransmissionParser parser;
+  std::vector<TransmissionInfo> infos;
+  ASSERT_TRUE(parser.parse(urdf, infos));
+  ASSERT_EQ(1, infos.size());
+  EXPECT_EQ("simple_trans", infos.front().name_);
+  ASSERT_EQ(1, infos.front().joints_.size());
+  ASSERT_EQ(1, infos.front().actuators_.size());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);